@@ -0,0 +1,399 @@
+
+#include "bitboard.hpp"
+
+#include <algorithm>
+#include <cassert>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+
+namespace {
+
+//// The cell offsets (row, column) of shapes which are used to find patterns
+//// The first offset of every shape is the anchor (0, 0)
+using offset_t = int[2];
+
+const offset_t square_shape[] = { { 0, 0 }, { 0, 1 }, { 1, 0 }, { 1, 1 } };
+
+size_t popcount(uint64_t w) noexcept
+{
+#ifdef _MSC_VER
+	return static_cast<size_t>(__popcnt64(w));
+#else
+	return static_cast<size_t>(__builtin_popcountll(w));
+#endif
+}
+
+//// Gets the cells covered by every placement of given shape in given mask
+bitboard match_shape(const bitboard& m, const offset_t* shape, size_t n)
+{
+	bitboard anchors = m;
+	for (size_t i = 1; i < n; ++i) {
+		anchors &= m.shifted(-shape[i][0], -shape[i][1]);
+	}
+	bitboard covered = anchors;
+	for (size_t i = 1; i < n; ++i) {
+		covered |= anchors.shifted(shape[i][0], shape[i][1]);
+	}
+	return covered;
+}
+
+}
+
+
+bitboard::bitboard() noexcept
+	: m_inline{ 0, 0 }
+	, m_words_count(0)
+	, m_rows(0)
+	, m_cols(0)
+{
+}
+
+bitboard::bitboard(size_t r, size_t c)
+	: m_inline{ 0, 0 }
+	, m_words_count((r * c + 63) / 64)
+	, m_rows(static_cast<uint8_t>(r))
+	, m_cols(static_cast<uint8_t>(c))
+{
+	assert(r <= board_index::max_coordinate + 1 && c <= board_index::max_coordinate + 1);
+	if (m_words_count > inline_words_count) {
+		m_heap.reset(new uint64_t[m_words_count]);
+		std::fill(m_heap.get(), m_heap.get() + m_words_count, 0);
+	}
+}
+
+bitboard::bitboard(const bitboard& b)
+	: m_inline{ b.m_inline[0], b.m_inline[1] }
+	, m_words_count(b.m_words_count)
+	, m_rows(b.m_rows)
+	, m_cols(b.m_cols)
+{
+	if (b.m_heap) {
+		m_heap.reset(new uint64_t[m_words_count]);
+		std::copy(b.m_heap.get(), b.m_heap.get() + m_words_count, m_heap.get());
+	}
+}
+
+bitboard::bitboard(bitboard&& b) noexcept
+	: m_inline{ b.m_inline[0], b.m_inline[1] }
+	, m_heap(std::move(b.m_heap))
+	, m_words_count(b.m_words_count)
+	, m_rows(b.m_rows)
+	, m_cols(b.m_cols)
+{
+	b.release();
+}
+
+bitboard& bitboard::operator= (const bitboard& b)
+{
+	if (this == &b) {
+		return *this;
+	}
+	if (b.m_heap) {
+		if (!m_heap || m_words_count != b.m_words_count) {
+			m_heap.reset(new uint64_t[b.m_words_count]);
+		}
+		std::copy(b.m_heap.get(), b.m_heap.get() + b.m_words_count, m_heap.get());
+	} else {
+		m_heap.reset();
+	}
+	m_inline[0] = b.m_inline[0];
+	m_inline[1] = b.m_inline[1];
+	m_words_count = b.m_words_count;
+	m_rows = b.m_rows;
+	m_cols = b.m_cols;
+	return *this;
+}
+
+bitboard& bitboard::operator= (bitboard&& b) noexcept
+{
+	if (this == &b) {
+		return *this;
+	}
+	m_inline[0] = b.m_inline[0];
+	m_inline[1] = b.m_inline[1];
+	m_heap = std::move(b.m_heap);
+	m_words_count = b.m_words_count;
+	m_rows = b.m_rows;
+	m_cols = b.m_cols;
+	b.release();
+	return *this;
+}
+
+void bitboard::release() noexcept
+{
+	//// the heap storage is moved out, so the bitboard falls back to the empty inline storage
+	m_inline[0] = 0;
+	m_inline[1] = 0;
+	m_heap.reset();
+	m_words_count = 0;
+	m_rows = 0;
+	m_cols = 0;
+}
+
+uint64_t* bitboard::words() noexcept
+{
+	return m_heap ? m_heap.get() : m_inline;
+}
+
+const uint64_t* bitboard::words() const noexcept
+{
+	return m_heap ? m_heap.get() : m_inline;
+}
+
+size_t bitboard::rows() const noexcept
+{
+	return m_rows;
+}
+
+size_t bitboard::columns() const noexcept
+{
+	return m_cols;
+}
+
+size_t bitboard::get_raw_index(const board_index& i) const noexcept
+{
+	assert(i.row() < m_rows && i.column() < m_cols);
+	return i.row() * m_cols + i.column();
+}
+
+bool bitboard::test(const board_index& i) const noexcept
+{
+	const size_t ri = get_raw_index(i);
+	return (words()[ri / 64] >> (ri % 64)) & 1;
+}
+
+void bitboard::set(const board_index& i) noexcept
+{
+	const size_t ri = get_raw_index(i);
+	words()[ri / 64] |= uint64_t(1) << (ri % 64);
+}
+
+void bitboard::reset(const board_index& i) noexcept
+{
+	const size_t ri = get_raw_index(i);
+	words()[ri / 64] &= ~(uint64_t(1) << (ri % 64));
+}
+
+void bitboard::clear() noexcept
+{
+	uint64_t* w = words();
+	std::fill(w, w + m_words_count, 0);
+}
+
+bool bitboard::any() const noexcept
+{
+	const uint64_t* w = words();
+	for (size_t i = 0; i < m_words_count; ++i) {
+		if (w[i] != 0) {
+			return true;
+		}
+	}
+	return false;
+}
+
+bool bitboard::none() const noexcept
+{
+	return !any();
+}
+
+size_t bitboard::count() const noexcept
+{
+	const uint64_t* w = words();
+	size_t c = 0;
+	for (size_t i = 0; i < m_words_count; ++i) {
+		c += popcount(w[i]);
+	}
+	return c;
+}
+
+uint32_t bitboard::get_row_bits(int r, int c, size_t n) const noexcept
+{
+	assert(n <= 32);
+	if (r < 0 || r >= static_cast<int>(m_rows)) {
+		return 0;
+	}
+	const int first = std::max(c, 0);
+	const int last = std::min(c + static_cast<int>(n), static_cast<int>(m_cols));
+	if (first >= last) {
+		return 0;
+	}
+	const size_t bit = static_cast<size_t>(r) * m_cols + first;
+	const size_t count = static_cast<size_t>(last - first);
+	const uint64_t* w = words();
+	uint64_t v = w[bit / 64] >> (bit % 64);
+	if (bit % 64 + count > 64) {
+		v |= w[bit / 64 + 1] << (64 - bit % 64);
+	}
+	v &= (uint64_t(1) << count) - 1;
+	return static_cast<uint32_t>(v << (first - c));
+}
+
+size_t bitboard::lowest_bit(uint64_t w) noexcept
+{
+	assert(w != 0);
+#ifdef _MSC_VER
+	unsigned long i = 0;
+	_BitScanForward64(&i, w);
+	return static_cast<size_t>(i);
+#else
+	return static_cast<size_t>(__builtin_ctzll(w));
+#endif
+}
+
+bitboard bitboard::shifted_raw(int n) const
+{
+	bitboard b(m_rows, m_cols);
+	const uint64_t* src = words();
+	uint64_t* dst = b.words();
+	const size_t count = m_words_count;
+	if (n >= 0) {
+		const size_t q = static_cast<size_t>(n) / 64;
+		const size_t r = static_cast<size_t>(n) % 64;
+		for (size_t i = count; i-- > q;) {
+			uint64_t v = src[i - q] << r;
+			if (r != 0 && i > q) {
+				v |= src[i - q - 1] >> (64 - r);
+			}
+			dst[i] = v;
+		}
+	} else {
+		const size_t q = static_cast<size_t>(-n) / 64;
+		const size_t r = static_cast<size_t>(-n) % 64;
+		for (size_t i = 0; i + q < count; ++i) {
+			uint64_t v = src[i + q] >> r;
+			if (r != 0 && i + q + 1 < count) {
+				v |= src[i + q + 1] << (64 - r);
+			}
+			dst[i] = v;
+		}
+	}
+	b.trim();
+	return b;
+}
+
+void bitboard::set_range(size_t first, size_t count) noexcept
+{
+	uint64_t* w = words();
+	while (count != 0) {
+		const size_t offset = first % 64;
+		const size_t n = std::min(count, 64 - offset);
+		const uint64_t bits = n == 64 ? ~uint64_t(0) : ((uint64_t(1) << n) - 1) << offset;
+		w[first / 64] |= bits;
+		first += n;
+		count -= n;
+	}
+}
+
+bitboard bitboard::columns_mask(size_t first, size_t count) const
+{
+	bitboard b(m_rows, m_cols);
+	for (size_t r = 0; r < m_rows; ++r) {
+		b.set_range(r * m_cols + first, count);
+	}
+	return b;
+}
+
+void bitboard::trim() noexcept
+{
+	const size_t size = static_cast<size_t>(m_rows) * m_cols;
+	if (size % 64 != 0) {
+		words()[m_words_count - 1] &= (uint64_t(1) << (size % 64)) - 1;
+	}
+}
+
+bitboard bitboard::shifted(int dr, int dc) const
+{
+	if (dc >= static_cast<int>(m_cols) || -dc >= static_cast<int>(m_cols)) {
+		return bitboard(m_rows, m_cols);
+	}
+	bitboard b = shifted_raw(dr * static_cast<int>(m_cols) + dc);
+	if (dc > 0) {
+		b &= columns_mask(dc, m_cols - dc);
+	} else if (dc < 0) {
+		b &= columns_mask(0, m_cols + dc);
+	}
+	return b;
+}
+
+bitboard bitboard::squares() const
+{
+	return match_shape(*this, square_shape, 4);
+}
+
+bitboard bitboard::operator& (const bitboard& b) const
+{
+	bitboard r = *this;
+	return r &= b;
+}
+
+bitboard bitboard::operator| (const bitboard& b) const
+{
+	bitboard r = *this;
+	return r |= b;
+}
+
+bitboard bitboard::operator^ (const bitboard& b) const
+{
+	bitboard r = *this;
+	return r ^= b;
+}
+
+bitboard bitboard::operator~ () const
+{
+	bitboard r = *this;
+	uint64_t* w = r.words();
+	for (size_t i = 0; i < m_words_count; ++i) {
+		w[i] = ~w[i];
+	}
+	r.trim();
+	return r;
+}
+
+bitboard& bitboard::operator&= (const bitboard& b) noexcept
+{
+	assert(m_rows == b.m_rows && m_cols == b.m_cols);
+	uint64_t* w = words();
+	const uint64_t* bw = b.words();
+	for (size_t i = 0; i < m_words_count; ++i) {
+		w[i] &= bw[i];
+	}
+	return *this;
+}
+
+bitboard& bitboard::operator|= (const bitboard& b) noexcept
+{
+	assert(m_rows == b.m_rows && m_cols == b.m_cols);
+	uint64_t* w = words();
+	const uint64_t* bw = b.words();
+	for (size_t i = 0; i < m_words_count; ++i) {
+		w[i] |= bw[i];
+	}
+	return *this;
+}
+
+bitboard& bitboard::operator^= (const bitboard& b) noexcept
+{
+	assert(m_rows == b.m_rows && m_cols == b.m_cols);
+	uint64_t* w = words();
+	const uint64_t* bw = b.words();
+	for (size_t i = 0; i < m_words_count; ++i) {
+		w[i] ^= bw[i];
+	}
+	return *this;
+}
+
+bool bitboard::operator== (const bitboard& b) const noexcept
+{
+	if (m_rows != b.m_rows || m_cols != b.m_cols) {
+		return false;
+	}
+	return std::equal(words(), words() + m_words_count, b.words());
+}
+
+bool bitboard::operator!= (const bitboard& b) const noexcept
+{
+	return !this->operator==(b);
+}
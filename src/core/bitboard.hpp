@@ -0,0 +1,143 @@
+#ifndef CORE_BITBOARD_HPP
+#define CORE_BITBOARD_HPP
+
+#include "board_index.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+
+//// @class bitboard
+//// @brief Keeps one bit per board cell (row-major, bit = row * columns + column)
+//// Bitboard is used to keep occupancy masks of board: a mask per figure color and a mask per booster type.
+//// Masks can be shifted and combined with bitwise operations, so the patterns can be found
+//// for the whole board at once instead of walking through the board items.
+//// @note Masks of boards up to 128 cells (e.g. 10x10) are kept inline, bigger boards use heap storage
+class bitboard
+{
+public:
+	//// @brief Constructor
+	//// @note Creates an empty bitboard with 0x0 size
+	bitboard() noexcept;
+
+	//// @brief Constructor
+	//// @param[in] r The rows count
+	//// @param[in] c The columns count
+	bitboard(size_t r, size_t c);
+
+	//// @brief Copy Constructor
+	bitboard(const bitboard&);
+
+	//// @brief Move Constructor
+	//// @note The moved bitboard becomes empty with 0x0 size
+	bitboard(bitboard&&) noexcept;
+
+	//// @brief Copy Assignment
+	//// @note Storage is reused if sizes are same
+	bitboard& operator= (const bitboard&);
+
+	//// @brief Move Assignment
+	//// @note The moved bitboard becomes empty with 0x0 size
+	bitboard& operator= (bitboard&&) noexcept;
+
+	//// @brief Destructor
+	~bitboard() = default;
+
+public:
+	//// @brief Gets the rows count
+	size_t rows() const noexcept;
+
+	//// @brief Gets the columns count
+	size_t columns() const noexcept;
+
+	//// @brief Checks if bit of given index is set or not
+	bool test(const board_index&) const noexcept;
+
+	//// @brief Sets the bit of given index
+	void set(const board_index&) noexcept;
+
+	//// @brief Resets the bit of given index
+	void reset(const board_index&) noexcept;
+
+	//// @brief Resets all bits
+	void clear() noexcept;
+
+	//// @brief Checks if any bit is set
+	bool any() const noexcept;
+
+	//// @brief Checks if no bit is set
+	bool none() const noexcept;
+
+	//// @brief Gets the count of set bits
+	size_t count() const noexcept;
+
+	//// @brief Gets the bits of given row part
+	//// @param[in] r The row
+	//// @param[in] c The first column
+	//// @param[in] n The columns count (up to 32)
+	//// @return The bit k is the bit of column c + k, the cells outside of the board have 0 bits
+	uint32_t get_row_bits(int r, int c, size_t n) const noexcept;
+
+	//// @brief Gets the mask moved by given rows and columns
+	//// E.g. shifted(0, 1) moves every bit to the right neighbour cell
+	//// @note Bits which leave the board are dropped (there is no wrapping between rows)
+	bitboard shifted(int dr, int dc) const;
+
+	//// @brief Gets the cells which are covered by 2x2 squares
+	bitboard squares() const;
+
+	//// @brief Calls given function for every set bit with the bit's index
+	template <typename F>
+	void for_each(F f) const
+	{
+		const uint64_t* w = words();
+		for (size_t i = 0; i < m_words_count; ++i) {
+			uint64_t word = w[i];
+			while (word != 0) {
+				const size_t bit = i * 64 + lowest_bit(word);
+				f(board_index(bit / m_cols, bit % m_cols));
+				word &= word - 1;
+			}
+		}
+	}
+
+public:
+	bitboard operator& (const bitboard&) const;
+	bitboard operator| (const bitboard&) const;
+	bitboard operator^ (const bitboard&) const;
+
+	//// @brief Inverts the bits inside of the board area
+	bitboard operator~ () const;
+
+	bitboard& operator&= (const bitboard&) noexcept;
+	bitboard& operator|= (const bitboard&) noexcept;
+	bitboard& operator^= (const bitboard&) noexcept;
+
+	bool operator== (const bitboard&) const noexcept;
+	bool operator!= (const bitboard&) const noexcept;
+
+private:
+	static constexpr size_t inline_words_count = 2;
+
+	static size_t lowest_bit(uint64_t) noexcept;
+
+	uint64_t* words() noexcept;
+	const uint64_t* words() const noexcept;
+	size_t get_raw_index(const board_index&) const noexcept;
+	bitboard shifted_raw(int) const;
+	bitboard columns_mask(size_t, size_t) const;
+	void set_range(size_t, size_t) noexcept;
+	void trim() noexcept;
+	void release() noexcept;
+
+private:
+	uint64_t m_inline[inline_words_count];
+	std::unique_ptr<uint64_t[]> m_heap;
+	size_t m_words_count;
+	uint8_t m_rows;
+	uint8_t m_cols;
+
+};
+
+#endif // CORE_BITBOARD_HPP
@@ -1,277 +1,444 @@
-
-#include "board.hpp"
-#include "boosters.hpp"
-#include "board_item.hpp"
-#include "figure.hpp"
-#include "notifier.hpp"
-#include "proxy_figure.hpp"
-
-#include <algorithm>
-#include <cassert>
-#include <iostream>
-#include <random>
-
-
-
-size_t board::min_size() noexcept
-{
-    return 7;
-}
-
-
-size_t board::max_size() noexcept
-{
-    return 10;
-}
-
-board::board(size_t r, size_t c)
-    : m_rows(r)
-    , m_cols(c)
-{
-    m_data = std::vector<board_item*>(m_rows * m_cols, nullptr);
-}
-
-board::~board()
-{
-    for (auto it : m_data) {
-        if (it != nullptr) {
-            delete it;
-            it = nullptr;
-        }
-    }
-}
-
-size_t board::rows() const noexcept
-{
-    return m_rows;
-}
-
-size_t board::columns() const noexcept
-{
-    return m_cols;
-}
-
-size_t board::get_raw_index(const index& i) const noexcept
-{
-    assert(i.is_valid());
-    return i.row() * m_cols + i.column();
-}
-
-index board::get_index_from_raw(size_t raw_index) const noexcept
-{
-	assert(raw_index < m_data.size());
-	size_t r = raw_index / m_cols;
-	size_t c = raw_index % m_cols;
-	return index(r, c);
-}
-
-void board::add_item(board_item* item, const index& i)
-{
-    assert(item != nullptr);
-    const size_t ri = get_raw_index(i);
-    assert(ri < m_data.size());
-    if (m_data[ri] != nullptr) {
-        delete m_data[ri];
-    }
-    m_data[ri] = item;
-}
-
-void board::destroy_item(const index& i)
-{
-    if (!i.is_valid()) {
-        return;
-    }
-    const size_t ri = get_raw_index(i);
-    if (m_data[ri] != nullptr) {
-        delete m_data[ri];
-        m_data[ri] = nullptr;
-    }
-}
-
-void board::drop_column(const size_t col_index)
-{
-	std::list<index> di;
-	drop_column(col_index, di);
-}
-
-void board::drop_column(const size_t col_index, std::list<index>& dropped_indexes)
-{
-	std::list<std::pair<index, index>> swap_indexes;
-	for (int i = m_rows - 1; i >= 0; --i) {
-		index current(i, col_index);
-		if (!current.is_valid()) {
-			continue;
-		}
-		const size_t ri = get_raw_index(current);
-		if (m_data[ri] == nullptr) {
-			continue;
-		}
-		size_t tmp = i;
-		if (tmp == m_rows - 1) {
-			continue;
-		}
-		++tmp;
-		while (tmp < m_rows) {
-			index next(tmp, col_index);
-			if (!next.is_valid()) {
-				++tmp;
-				continue;
-			}
-			const size_t next_ri = get_raw_index(next);
-
-			if (m_data[next_ri] == nullptr) {
-				swap_indexes.push_back(std::make_pair(current, next));
-				swap(current, next);
-				dropped_indexes.push_back(next);
-				current = next;
-				++tmp;
-			}
-			else {
-				break;
-			}
-		}
-	}
-}
-
-void board::swap(const index& i1, const index& i2)
-{
-	assert(can_swap(i1, i2));
-    const size_t ri1 = get_raw_index(i1);
-    const size_t ri2 = get_raw_index(i2);
-    board_item* tmp = m_data[ri1];
-    m_data[ri1] = m_data[ri2];
-    m_data[ri2] = tmp;
-}
-
-bool board::can_swap(const index& i1, const index& i2) const noexcept
-{
-	if (i1 == i2) {
-		return false;
-	}
-    return is_neighbours(i1, i2);
-}
-
-bool board::is_neighbours(const index& i1, const index& i2) const noexcept
-{
-    if (!i1.is_valid() || !i2.is_valid()) {
-        return false;
-    }
-    if (i1.row() == i2.row()) {
-        const size_t col1 = i1.column();
-        const size_t col2 = i2.column();
-        return col1 + 1 == col2 || col1 - 1 == col2;
-    } else if (i1.column() == i2.column()) {
-        const size_t row1 = i1.row();
-        const size_t row2 = i2.row();
-        return row1 + 1 == row2 || row1 - 1 == row2;
-    }
-    return false;
-}
-
-board_item* board::get_item(const index& i) const noexcept
-{
-    if (!i.is_valid()) {
-        return nullptr;
-    }
-    const size_t raw_index = get_raw_index(i);
-    assert(raw_index < m_data.size());
-    return m_data[raw_index];
-}
-
-void board::get_empty_tiles(std::list<index>& l) const
-{
-	for (size_t i = 0; i < m_data.size(); ++i) {
-		if (m_data[i] == nullptr) {
-			l.push_back(std::move(get_index_from_raw(i)));
-		}
-	}
-}
-
-
-void board::add_proxy_figure(const proxy_figure* f) noexcept
-{
-	assert(f != nullptr);
-	m_proxy_items.insert(std::make_pair(f->get_index(), f->get_color()));
-}
-
-void board::remove_proxy_figure(const proxy_figure* f) noexcept
-{
-	assert(f != nullptr);
-	m_proxy_items.erase(f->get_index());
-}
-
-bool board::is_proxy_item(const index& i) const noexcept
-{
-	if (m_proxy_items.empty()) {
-		return false;
-	}
-	if (!i.is_valid()) {
-		return false;
-	}
-	return m_proxy_items.find(i) != m_proxy_items.end();
-}
-
-figure::color board::get_proxy_color(const index& i) const noexcept
-{
-	if (!is_proxy_item(i)) {
-		return figure::color::UNDEFINED;
-	}
-	try {
-		return m_proxy_items.at(i);
-	} catch (const std::out_of_range&) {
-	}
-	return figure::color::UNDEFINED;
-}
-
-void board::shuffle()
-{
-	std::random_device rd;
-	std::mt19937 g(rd());
-	std::shuffle(m_data.begin(), m_data.end(), g);
-}
-
-
-/// XXX
-namespace  {
-
-char get_c(board_item* i) {
-    figure* f = dynamic_cast<figure*>(i);
-    if (f) {
-        switch (f->get_color()) {
-            case figure::color::blue: return 'B';
-            case figure::color::green: return 'G';
-            case figure::color::orange: return 'O';
-            case figure::color::red: return 'R';
-            case figure::color::violet: return 'V';
-            case figure::color::UNDEFINED:
-            default:;
-        }
-    }
-    booster* b = dynamic_cast<booster*>(i);
-    if (b != nullptr) {
-        switch (b->get_type()) {
-            case booster::type::horizontal:
-                return '-';
-            case booster::type::vertical:
-                return '|';
-            case booster::type::radial:
-                return '*';
-        }
-    }
-    return 0;
-}
-}
-
-void board::draw()
-{
-    std::cout << __FUNCSIG__ << std::endl;
-    for (size_t i = 0; i < m_rows; ++i) {
-        for (size_t j = 0; j < m_cols; ++j) {
-            if (m_data[i * m_cols + j] == nullptr) {
-                std::cout << "  ";
-                continue;
-            }
-            std::cout << get_c(m_data[i * m_cols + j]) << " ";
-        } std::cout << std::endl;
-    }
-}
+
+#include "board.hpp"
+#include "boosters.hpp"
+#include "cell.hpp"
+#include "figure.hpp"
+#include "line_kernel.hpp"
+#include "splitmix.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <iostream>
+
+
+
+size_t board::min_size() noexcept
+{
+    return 7;
+}
+
+
+size_t board::max_size() noexcept
+{
+    return board_index::max_coordinate + 1;
+}
+
+board::board(size_t r, size_t c)
+    : m_kernels(&board_kernels::get(r, c))
+    , m_rows(r)
+    , m_cols(c)
+{
+    m_data = std::vector<cell>(m_rows * m_cols);
+	rebuild_masks();
+}
+
+size_t board::rows() const noexcept
+{
+    return m_rows;
+}
+
+size_t board::columns() const noexcept
+{
+    return m_cols;
+}
+
+size_t board::get_raw_index(const board_index& i) const noexcept
+{
+    assert(contains(i));
+    return i.row() * m_cols + i.column();
+}
+
+board_index board::get_index_from_raw(size_t raw_index) const noexcept
+{
+	assert(raw_index < m_data.size());
+	size_t r = raw_index / m_cols;
+	size_t c = raw_index % m_cols;
+	return board_index(r, c);
+}
+
+void board::add_item(const cell& item, const board_index& i)
+{
+    assert(!item.is_empty());
+    const size_t ri = get_raw_index(i);
+    assert(ri < m_data.size());
+	update_masks(i, m_data[ri], false);
+    m_data[ri] = item;
+	update_masks(i, item, true);
+}
+
+cell board::destroy_item(const board_index& i)
+{
+    if (!contains(i)) {
+        return cell();
+    }
+    const size_t ri = get_raw_index(i);
+	const cell destroyed = m_data[ri];
+	update_masks(i, destroyed, false);
+	m_data[ri] = cell();
+	update_masks(i, m_data[ri], true);
+	return destroyed;
+}
+
+void board::drop_items(moves& m)
+{
+	if (m_empty_count == 0) {
+		return;
+	}
+	//// the moves are found on current cells, every move's target is empty when it is done
+	const size_t first = m.size();
+	m_kernels->find_drops(get_raw_cells(), m);
+	for (size_t k = first; k < m.size(); ++k) {
+		move_item(m[k].first, m[k].second);
+	}
+}
+
+void board::move_item(const board_index& from, const board_index& to) noexcept
+{
+	const size_t from_ri = get_raw_index(from);
+	const size_t to_ri = get_raw_index(to);
+	assert(m_data[to_ri].is_empty());
+	const cell item = m_data[from_ri];
+	update_masks(from, item, false);
+	update_masks(to, m_data[to_ri], false);
+	m_data[to_ri] = item;
+	m_data[from_ri] = cell();
+	update_masks(from, m_data[from_ri], true);
+	update_masks(to, item, true);
+}
+
+void board::swap(const board_index& i1, const board_index& i2)
+{
+	assert(can_swap(i1, i2));
+    const size_t ri1 = get_raw_index(i1);
+    const size_t ri2 = get_raw_index(i2);
+    const cell tmp = m_data[ri1];
+	update_masks(i1, tmp, false);
+	update_masks(i2, m_data[ri2], false);
+    m_data[ri1] = m_data[ri2];
+    m_data[ri2] = tmp;
+	update_masks(i1, m_data[ri1], true);
+	update_masks(i2, m_data[ri2], true);
+}
+
+bool board::can_swap(const board_index& i1, const board_index& i2) const noexcept
+{
+	if (i1 == i2) {
+		return false;
+	}
+    return is_neighbours(i1, i2);
+}
+
+bool board::is_neighbours(const board_index& i1, const board_index& i2) const noexcept
+{
+    if (!contains(i1) || !contains(i2)) {
+        return false;
+    }
+    if (i1.row() == i2.row()) {
+        const size_t col1 = i1.column();
+        const size_t col2 = i2.column();
+        return col1 + 1 == col2 || col1 - 1 == col2;
+    } else if (i1.column() == i2.column()) {
+        const size_t row1 = i1.row();
+        const size_t row2 = i2.row();
+        return row1 + 1 == row2 || row1 - 1 == row2;
+    }
+    return false;
+}
+
+cell board::get_cell(const board_index& i) const noexcept
+{
+    if (!contains(i)) {
+        return cell();
+    }
+    const size_t raw_index = get_raw_index(i);
+    assert(raw_index < m_data.size());
+    return m_data[raw_index];
+}
+
+board_item* board::get_item(const board_index& i) const noexcept
+{
+	return get_cell(i).get_item();
+}
+
+const bitboard& board::get_empty_mask() const noexcept
+{
+	return m_empty_mask;
+}
+
+size_t board::get_empty_count(size_t col_index) const noexcept
+{
+	assert(col_index < m_empty_counts.size());
+	return m_empty_counts[col_index];
+}
+
+size_t board::get_empty_count() const noexcept
+{
+	return m_empty_count;
+}
+
+bool board::has_empty_cells() const noexcept
+{
+	return m_empty_count != 0;
+}
+
+
+void board::shuffle(rng& r)
+{
+	for (size_t i = m_data.size(); i > 1; --i) {
+		std::swap(m_data[i - 1], m_data[r.next_below(static_cast<uint32_t>(i))]);
+	}
+	rebuild_masks();
+}
+
+board::ptr board::clone() const
+{
+	return ptr(new board(*this));
+}
+
+board::state board::snapshot() const
+{
+	state s;
+	s.rows = m_rows;
+	s.cols = m_cols;
+	s.cells = m_data;
+	s.color_masks = m_color_masks;
+	s.booster_masks = m_booster_masks;
+	s.empty_mask = m_empty_mask;
+	s.empty_counts = m_empty_counts;
+	s.empty_count = m_empty_count;
+	s.hash = m_hash;
+	return s;
+}
+
+void board::restore(const state& s)
+{
+	assert(s.rows == m_rows && s.cols == m_cols);
+	assert(s.cells.size() == m_data.size());
+	m_data = s.cells;
+	m_color_masks = s.color_masks;
+	m_booster_masks = s.booster_masks;
+	m_empty_mask = s.empty_mask;
+	m_empty_counts = s.empty_counts;
+	m_empty_count = s.empty_count;
+	m_hash = s.hash;
+	m_changed_mask = ~bitboard(m_rows, m_cols);
+}
+
+bitboard board::get_matches_mask() const
+{
+	bitboard b = get_runs_mask();
+	for (const auto& it : m_color_masks) {
+		b |= it.squares();
+	}
+	return b;
+}
+
+void board::get_runs(bool vertical, board_kernels::runs& r) const
+{
+	m_kernels->find_runs(get_raw_cells(), vertical, r);
+}
+
+void board::add_blast_mask(const booster::type& t, const board_index& i, bitboard& out) const
+{
+	assert(contains(i));
+	m_kernels->add_blast(t, i, out);
+}
+
+void board::get_chain_mask(const board_index& i, bitboard& out) const
+{
+	assert(contains(i));
+	assert(get_cell(i).is_booster());
+	assert(out.rows() == m_rows && out.columns() == m_cols);
+	out.clear();
+	m_kernels->add_blast(get_cell(i).get_booster_type(), i, out);
+	bitboard activated(m_rows, m_cols);
+	activated.set(i);
+	bitboard covered(m_rows, m_cols);
+	bool changed = true;
+	while (changed) {
+		changed = false;
+		for (size_t t = 0; t < booster::types_count; ++t) {
+			covered = out;
+			covered &= m_booster_masks[t];
+			covered &= ~activated;
+			if (covered.none()) {
+				continue;
+			}
+			activated |= covered;
+			const booster::type bt = static_cast<booster::type>(t);
+			covered.for_each([this, bt, &out](const board_index& it) {
+				m_kernels->add_blast(bt, it, out);
+			});
+			changed = true;
+		}
+	}
+}
+
+bitboard board::get_runs_mask() const
+{
+	std::vector<uint8_t> horizontal(m_data.size());
+	std::vector<uint8_t> vertical(m_data.size());
+	line_kernel::find_runs(get_raw_cells(), m_rows, m_cols, false, horizontal.data());
+	line_kernel::find_runs(get_raw_cells(), m_rows, m_cols, true, vertical.data());
+	bitboard mask(m_rows, m_cols);
+	for (size_t i = 0; i < m_data.size(); ++i) {
+		if (horizontal[i] != 0 || vertical[i] != 0) {
+			mask.set(get_index_from_raw(i));
+		}
+	}
+	return mask;
+}
+
+bitboard board::get_swaps_mask(bool vertical, size_t first_row, size_t last_row) const
+{
+	assert(first_row <= last_row && last_row < m_rows);
+	//// a swap depends on two rows above and three rows below it (the bottom neighbour's runs),
+	//// so the kernel gets only these rows, the rows outside of them are considered empty
+	const size_t first = first_row < 2 ? 0 : first_row - 2;
+	const size_t last = std::min(last_row + 3, m_rows - 1);
+	std::vector<uint8_t> swaps((last - first + 1) * m_cols);
+	line_kernel::find_swaps(get_raw_cells() + first * m_cols, last - first + 1, m_cols, vertical, swaps.data());
+	bitboard mask(m_rows, m_cols);
+	for (size_t r = first_row; r <= last_row; ++r) {
+		for (size_t c = 0; c < m_cols; ++c) {
+			if (swaps[(r - first) * m_cols + c] != 0) {
+				mask.set(board_index(r, c));
+			}
+		}
+	}
+	return mask;
+}
+
+uint64_t board::hash() const noexcept
+{
+	return m_hash;
+}
+
+const bitboard& board::get_color_mask(const figure::color& c) const noexcept
+{
+	assert(c != figure::color::UNDEFINED);
+	return m_color_masks[static_cast<size_t>(c)];
+}
+
+const bitboard& board::get_booster_mask(const booster::type& t) const noexcept
+{
+	return m_booster_masks[static_cast<size_t>(t)];
+}
+
+const bitboard& board::get_changed_mask() const noexcept
+{
+	return m_changed_mask;
+}
+
+void board::clear_changed_mask() noexcept
+{
+	m_changed_mask.clear();
+}
+
+void board::update_masks(const board_index& i, const cell& item, bool occupied) noexcept
+{
+	m_changed_mask.set(i);
+	if (item.is_empty()) {
+		if (occupied) {
+			m_empty_mask.set(i);
+			++m_empty_counts[i.column()];
+			++m_empty_count;
+		} else {
+			m_empty_mask.reset(i);
+			--m_empty_counts[i.column()];
+			--m_empty_count;
+		}
+		return;
+	}
+	//// xor adds the key if the item is added and removes it if the item is removed
+	m_hash ^= get_hash_key(i, item);
+	bitboard* mask = nullptr;
+	if (item.is_figure()) {
+		mask = &m_color_masks[static_cast<size_t>(item.get_color())];
+	} else {
+		assert(item.is_booster());
+		mask = &m_booster_masks[static_cast<size_t>(item.get_booster_type())];
+	}
+	if (occupied) {
+		mask->set(i);
+	} else {
+		mask->reset(i);
+	}
+}
+
+uint64_t board::get_hash_key(const board_index& i, const cell& item) noexcept
+{
+	//// Keys are generated from the index and the cell value with splitmix64 instead of keeping a keys table:
+	//// the table for the biggest board would take megabytes, and keys are still fixed for each (index, value)
+	uint64_t k = static_cast<uint64_t>(i.raw()) << 8 | item.raw();
+	return splitmix::next(k);
+}
+
+const uint8_t* board::get_raw_cells() const noexcept
+{
+	static_assert(sizeof(cell) == sizeof(uint8_t), "cell should be kept in one byte");
+	return reinterpret_cast<const uint8_t*>(m_data.data());
+}
+
+void board::reset_masks() noexcept
+{
+	m_color_masks.fill(bitboard(m_rows, m_cols));
+	m_booster_masks.fill(bitboard(m_rows, m_cols));
+	m_empty_mask = bitboard(m_rows, m_cols);
+	m_empty_counts.assign(m_cols, 0);
+	m_empty_count = 0;
+	m_hash = 0;
+	m_changed_mask = bitboard(m_rows, m_cols);
+}
+
+void board::rebuild_masks() noexcept
+{
+	reset_masks();
+	for (size_t i = 0; i < m_data.size(); ++i) {
+		update_masks(get_index_from_raw(i), m_data[i], true);
+	}
+}
+
+
+/// XXX
+namespace  {
+
+char get_c(const cell& i) {
+    if (i.is_figure()) {
+        switch (i.get_color()) {
+            case figure::color::blue: return 'B';
+            case figure::color::green: return 'G';
+            case figure::color::orange: return 'O';
+            case figure::color::red: return 'R';
+            case figure::color::violet: return 'V';
+            case figure::color::UNDEFINED:
+            default:;
+        }
+    }
+    if (i.is_booster()) {
+        switch (i.get_booster_type()) {
+            case booster::type::horizontal:
+                return '-';
+            case booster::type::vertical:
+                return '|';
+            case booster::type::radial:
+                return '*';
+        }
+    }
+    return 0;
+}
+}
+
+void board::draw()
+{
+    std::cout << __func__ << std::endl;
+    for (size_t i = 0; i < m_rows; ++i) {
+        for (size_t j = 0; j < m_cols; ++j) {
+            if (m_data[i * m_cols + j].is_empty()) {
+                std::cout << "  ";
+                continue;
+            }
+            std::cout << get_c(m_data[i * m_cols + j]) << " ";
+        } std::cout << std::endl;
+    }
+}
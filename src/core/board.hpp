@@ -1,113 +1,233 @@
-
-#ifndef CORE_BOARD_HPP
-#define CORE_BOARD_HPP
-
-#include "figure.hpp"
-#include "index.hpp"
-
-#include <list>
-#include <map>
-#include <memory>
-#include <vector>
-
-
-class board_item;
-class proxy_figure;
-
-
-//// @class board
-//// @brief Board keeps all items(figures and boosters) and allows to do some modifications
-//// It keeps items using std::vector. You can get specified item passing the item's index.
-//// The specified index will be converted to raw index and then return item if it exists.
-class board
-{
-public:
-    using ptr = std::unique_ptr<board>;
-
-public:
-	//// @brief Gets the minimum row/col size - 7
-    static size_t min_size() noexcept;
-
-	//// @brief Gets the minimum row/col size - 10
-    static size_t max_size() noexcept;
-
-public:
-	//// @brief Constructor
-    board(size_t, size_t);
-
-	//// @brief Destructor
-    ~board();
-
-public:
-	//// @brief Gets the board rows count
-    size_t rows() const noexcept;
-
-	//// @brief Gets the board columns count
-    size_t columns() const noexcept;
-
-	//// @brief Gets the board item with specified index
-	//// @return board_item if index is valid or nullptr
-	board_item* get_item(const index&) const noexcept;
-
-	//// @brief Sets the item to specified index
-	//// @note tem can be a figure or a booster
-    void add_item(board_item*, const index&);
-
-	//// @brief Removes given item from board
-	//// @note after destroying item their index should free. e.g nullptr
-	//// @note if specified board item it will replace existing item then destroy it
-    void destroy_item(const index&);
-
-	//// @brief Determines whether if two specified indexes can be swapped or not
-	//// @return true if neighbour indexes can be swapped and false otherwise
-	//// @note Swap can be completed only if after swapping indexes finds any pattern to match
-    bool can_swap(const index&, const index&) const noexcept;
-
-	//// @brief Swaps given two indexes in board
-	//// @note Given indexes can be swapped
-    void swap(const index&, const index&);
-
-	//// @brief Drop items down in given column while the bottom item(s) is free
-	void drop_column(const size_t);
-
-	//// @brief Drop items down in given column while the bottom item(s) is free
-	//// @note Collects dropped indexes to match
-    void drop_column(const size_t, std::list<index>&);
-
-	//// @brief Gets the empty tiles on board
-	void get_empty_tiles(std::list<index>&) const;
-
-	//// @brief Adds the specified proxy figure into proxy items map
-	void add_proxy_figure(const proxy_figure*) noexcept;
-
-	//// @brief Removes the specified proxy figure from proxy items map
-	void remove_proxy_figure(const proxy_figure*) noexcept;
-
-	//// @brief Checks in proxy items map if specified index is proxy item's index or not
-	bool is_proxy_item(const index&) const noexcept;
-
-	//// @brief Gets the proxy items color with given index
-	//// @return proxy item's color if it is exists, otherwise - figure::color::UNDEFINED
-	figure::color get_proxy_color(const index&) const noexcept;
-
-	//// @brief Shuffles the board;
-	void shuffle();
-
-
-	//// XXX
-    void draw();
-
-private:
-    size_t get_raw_index(const index&) const noexcept;
-	index get_index_from_raw(size_t) const noexcept;
-    bool is_neighbours(const index&, const index&) const noexcept;
-
-private:
-    std::vector<board_item*> m_data;
-	std::map<index, figure::color> m_proxy_items;
-    size_t m_rows;
-    size_t m_cols;
-
-};
-
-#endif // CORE_BOARD_HPP
+
+#ifndef CORE_BOARD_HPP
+#define CORE_BOARD_HPP
+
+#include "bitboard.hpp"
+#include "board_index.hpp"
+#include "board_kernels.hpp"
+#include "boosters.hpp"
+#include "cell.hpp"
+#include "figure.hpp"
+#include "rng.hpp"
+
+#include <array>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <utility>
+#include <vector>
+
+
+class board_item;
+
+
+//// @class board
+//// @brief Board keeps all items(figures and boosters) and allows to do some modifications
+//// It keeps items as cells (one byte value per item) using std::vector. You can get specified cell passing the item's index.
+//// The specified index will be converted to raw index and then return cell if it exists.
+//// Board also keeps occupancy masks (see bitboard) per figure color and per booster type.
+//// The masks are kept in sync with items, so patterns can be searched with bitwise operations.
+//// Empty cells are tracked the same way: board keeps the empty cells mask and the empty cells count per column.
+//// The Zobrist hash of the board is updated together with masks (see hash()).
+//// Board also collects the changed cells, so the data which depends on cells can be updated incrementally.
+class board
+{
+public:
+    using ptr = std::unique_ptr<board>;
+
+	//// The (from, to) indexes of moved items
+	using moves = std::vector<std::pair<board_index, board_index>>;
+
+	//// @struct state
+	//// @brief The snapshot of board cells and masks
+	//// @note State can be restored only on board with same rows and columns
+	struct state
+	{
+		size_t rows = 0;
+		size_t cols = 0;
+		std::vector<cell> cells;
+		std::array<bitboard, figure::colors_count> color_masks;
+		std::array<bitboard, booster::types_count> booster_masks;
+		bitboard empty_mask;
+		std::vector<size_t> empty_counts;
+		size_t empty_count = 0;
+		uint64_t hash = 0;
+	};
+
+public:
+	//// @brief Gets the minimum row/col size - 7
+	//// @note Smaller boards may have no arrangement with a valid move, so shuffle() would never end
+	//// @note GUI has own limits (see gui/definitions.hpp)
+    static size_t min_size() noexcept;
+
+	//// @brief Gets the maximum row/col size - 255
+	//// @note The value is limited by index (see board_index::max_coordinate)
+    static size_t max_size() noexcept;
+
+public:
+	//// @brief Constructor
+    board(size_t, size_t);
+
+	//// @brief Copy Constructor
+	//// @note Copies the flat cells array and masks, no items are allocated
+	board(const board&) = default;
+
+	//// @brief Copy Assignment
+	board& operator= (const board&) = default;
+
+	//// @brief Destructor
+    ~board() = default;
+
+public:
+	//// @brief Gets the board rows count
+    size_t rows() const noexcept;
+
+	//// @brief Gets the board columns count
+    size_t columns() const noexcept;
+
+	//// @brief Checks if given index is inside of the board
+	bool contains(const board_index& i) const noexcept
+	{
+		return i.row() < m_rows && i.column() < m_cols;
+	}
+
+	//// @brief Gets the cell with specified index
+	//// @return the cell if index is valid or an empty cell
+	cell get_cell(const board_index&) const noexcept;
+
+	//// @brief Gets the board item view of the cell with specified index
+	//// @return board_item if index is valid and cell isn't empty or nullptr
+	//// @note The returned object is shared between cells with same kind, don't delete it
+	board_item* get_item(const board_index&) const noexcept;
+
+	//// @brief Sets the item to specified index
+	//// @note Item can be a figure or a booster. Existing item will be replaced
+    void add_item(const cell&, const board_index&);
+
+	//// @brief Removes the item with given index from board
+	//// @note after destroying item their cell should be empty
+	//// @return the destroyed cell
+    cell destroy_item(const board_index&);
+
+	//// @brief Determines whether if two specified indexes can be swapped or not
+	//// @return true if neighbour indexes can be swapped and false otherwise
+	//// @note Swap can be completed only if after swapping indexes finds any pattern to match
+    bool can_swap(const board_index&, const board_index&) const noexcept;
+
+	//// @brief Swaps given two indexes in board
+	//// @note Given indexes can be swapped
+    void swap(const board_index&, const board_index&);
+
+	//// @brief Drops items down in all columns, so there are no empty cells under items
+	//// Each column is compacted with one sweep from bottom to top, columns without empty cells are skipped
+	//// @param[out] m The moved items (appended column by column, from bottom to top in each column)
+	void drop_items(moves& m);
+
+	//// @brief Gets the mask of empty cells
+	const bitboard& get_empty_mask() const noexcept;
+
+	//// @brief Gets the empty cells count in given column
+	size_t get_empty_count(size_t) const noexcept;
+
+	//// @brief Gets the empty cells count on board
+	size_t get_empty_count() const noexcept;
+
+	//// @brief Checks if board has empty cells or not
+	//// @note Board is settled when there are no empty cells
+	bool has_empty_cells() const noexcept;
+
+	//// @brief Shuffles the board with given generator
+	//// @note The board is shuffled with Fisher-Yates, so same generator state gives same board on every platform
+	void shuffle(rng&);
+
+	//// @brief Creates a copy of board
+	//// Copy can be modified (e.g. for lookahead or hints) without touching the current board
+	ptr clone() const;
+
+	//// @brief Gets the snapshot of current board state
+	state snapshot() const;
+
+	//// @brief Restores the board state from given snapshot
+	//// @note The snapshot should be taken from board with same size
+	void restore(const state&);
+
+	//// @brief Gets the cells which are covered by horizontal or vertical runs of at least 3 same color figures
+	//// @note Rows and columns are checked with vectorized kernel (see line_kernel)
+	bitboard get_runs_mask() const;
+
+	//// @brief Gets the cells which are covered by runs of 3 or 2x2 squares of same color figures
+	//// @note The runs are found with get_runs_mask(), the squares with color masks
+	bitboard get_matches_mask() const;
+
+	//// @brief Gets the runs of at least 3 same color figures in rows (or columns if vertical)
+	//// @note The board is checked with kernels which are specialized for the board size (see board_kernels)
+	void get_runs(bool vertical, board_kernels::runs&) const;
+
+	//// @brief Adds the impact area of booster with given type at given index (without chaining) to given mask
+	//// @note The areas are precomputed by kernels which are specialized for the board size (see board_kernels)
+	void add_blast_mask(const booster::type&, const board_index&, bitboard&) const;
+
+	//// @brief Gets the cells which are destroyed if the booster with given index is activated, including chained boosters
+	//// The area is found as a fixed point: the booster's area is extended with the areas of boosters
+	//// which are covered by it until no new booster is covered. Every booster is added once.
+	//// @note Board isn't modified, so the outcome of booster can be predicted (e.g. for hints or bots)
+	//// @note The cell with given index should keep a booster
+	void get_chain_mask(const board_index&, bitboard&) const;
+
+	//// @brief Gets the cells which make a match if they are swapped with their right (or bottom if vertical) neighbour
+	//// A swap makes a match if there is a run of 3 same color figures or a 2x2 square through the swapped cells.
+	//// @param[in] first_row The first row of checked swaps
+	//// @param[in] last_row The last row of checked swaps, the swaps of other rows aren't set in the mask
+	//// @note The swaps of the rows are checked at once with vectorized kernel (see line_kernel)
+	bitboard get_swaps_mask(bool vertical, size_t first_row, size_t last_row) const;
+
+	//// @brief Gets the Zobrist hash of the board
+	//// The hash is xor of keys of all non-empty cells, where key depends on the cell's index and value.
+	//// It is updated on every board change, so getting it costs nothing.
+	//// @note Boards with same size and same cells have same hashes (the keys don't depend on the board object or the run)
+	uint64_t hash() const noexcept;
+
+	//// @brief Gets the occupancy mask of figures with given color
+	const bitboard& get_color_mask(const figure::color&) const noexcept;
+
+	//// @brief Gets the occupancy mask of boosters with given type
+	const bitboard& get_booster_mask(const booster::type&) const noexcept;
+
+	//// @brief Gets the cells which were changed after the last clear_changed_mask() call
+	//// @note All cells are changed after shuffle() or restore()
+	const bitboard& get_changed_mask() const noexcept;
+
+	//// @brief Forgets the changed cells
+	void clear_changed_mask() noexcept;
+
+
+	//// XXX
+    void draw();
+
+private:
+    size_t get_raw_index(const board_index&) const noexcept;
+	board_index get_index_from_raw(size_t) const noexcept;
+    bool is_neighbours(const board_index&, const board_index&) const noexcept;
+	void move_item(const board_index&, const board_index&) noexcept;
+	void update_masks(const board_index&, const cell&, bool) noexcept;
+	static uint64_t get_hash_key(const board_index&, const cell&) noexcept;
+	const uint8_t* get_raw_cells() const noexcept;
+	void reset_masks() noexcept;
+	void rebuild_masks() noexcept;
+
+private:
+    std::vector<cell> m_data;
+	const board_kernels* m_kernels;
+	std::array<bitboard, figure::colors_count> m_color_masks;
+	std::array<bitboard, booster::types_count> m_booster_masks;
+	bitboard m_empty_mask;
+	std::vector<size_t> m_empty_counts;
+	size_t m_empty_count = 0;
+	uint64_t m_hash = 0;
+	bitboard m_changed_mask;
+    size_t m_rows;
+    size_t m_cols;
+
+};
+
+#endif // CORE_BOARD_HPP
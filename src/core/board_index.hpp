@@ -0,0 +1,104 @@
+#ifndef CORE_BOARD_INDEX_HPP
+#define CORE_BOARD_INDEX_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+
+//// @class board_index
+//// @brief Represents an board index item to set and get values using index
+//// The row and column are packed into 16 bits (8 bits per each), so index is cheap to copy and compare.
+//// Index doesn't know anything about board: use board::contains() to check if index is inside of the board.
+//// @note The coordinate value 255 is reserved to mark out of range coordinates.
+//// E.g. board_index(r, c - 1) for the first column or board_index(r, 300) are not valid indexes.
+class board_index
+{
+public:
+	//// @brief The maximum value of row or column which can be kept in index - 254
+	static constexpr size_t max_coordinate = 254;
+
+public:
+	//// @brief Constructor
+	//// @param[in] r The row index
+	//// @param[in] c The column index
+	//// @note Coordinates which are greater than max_coordinate are kept as out of range
+	constexpr board_index(size_t r, size_t c) noexcept
+		: m_value(static_cast<uint16_t>((pack(r) << 8) | pack(c)))
+	{
+	}
+
+	//// @brief Constructor
+	//// @note Don't use this function
+	//// Used to create static invalid index object during compilation
+	constexpr board_index(size_t invalid_value) noexcept
+		: board_index(invalid_value, invalid_value)
+	{
+	}
+
+public:
+	//// @brief Returns true if two indexes keeps same rows and columns, false - otherwise
+	constexpr bool operator== (const board_index& i) const noexcept
+	{
+		return m_value == i.m_value;
+	}
+
+	//// @brief Returns true if two indexes keeps different rows and columns, false - otherwise
+	constexpr bool operator!= (const board_index& i) const noexcept
+	{
+		return m_value != i.m_value;
+	}
+
+	//// @brief Returns true if first index is less than second
+	//// Less means that first index has smaller row index than second
+	//// If rows are equal checks the columns. First index's column should be smaller than second's column
+	constexpr bool operator<  (const board_index& i) const noexcept
+	{
+		return m_value < i.m_value;
+	}
+
+public:
+	//// @brief Gets the row's index
+	constexpr size_t row() const noexcept
+	{
+		return m_value >> 8;
+	}
+
+	//// @brief Gets the column's index
+	constexpr size_t column() const noexcept
+	{
+		return m_value & 0xff;
+	}
+
+	//// @brief Checks the index validity
+	//// @return false if row or column is out of range
+	//// @note Valid index can be outside of the board. See board::contains()
+	constexpr bool is_valid() const noexcept
+	{
+		return row() != out_of_range && column() != out_of_range;
+	}
+
+	//// @brief Gets the packed (row << 8 | column) value
+	constexpr uint16_t raw() const noexcept
+	{
+		return m_value;
+	}
+
+private:
+	static constexpr uint16_t out_of_range = 0xff;
+
+	static constexpr uint16_t pack(size_t v) noexcept
+	{
+		return v > max_coordinate ? out_of_range : static_cast<uint16_t>(v);
+	}
+
+private:
+    uint16_t m_value;
+};
+
+static constexpr size_t max_value = std::numeric_limits<size_t>::max();
+//// pre-defined invalid index
+static constexpr board_index invalid_index(max_value);
+
+
+#endif // CORE_BOARD_INDEX_HPP
@@ -0,0 +1,224 @@
+
+#include "board_kernels.hpp"
+#include "cell.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <map>
+#include <memory>
+#include <mutex>
+
+
+namespace {
+
+//// The board size which is known at compile time
+template <size_t R, size_t C>
+struct fixed_size
+{
+	static constexpr bool is_fixed = true;
+
+	constexpr size_t rows() const noexcept { return R; }
+	constexpr size_t cols() const noexcept { return C; }
+};
+
+//// The board size which is known at runtime
+struct runtime_size
+{
+	static constexpr bool is_fixed = false;
+
+	size_t r;
+	size_t c;
+
+	size_t rows() const noexcept { return r; }
+	size_t cols() const noexcept { return c; }
+};
+
+template <typename S>
+class kernels : public board_kernels
+{
+public:
+	explicit kernels(const S& s)
+		: m_size(s)
+	{
+		if (!S::is_fixed) {
+			return;
+		}
+		//// the areas of all boosters of the board: rows, then columns, then 3x3 squares
+		const size_t rows = m_size.rows();
+		const size_t cols = m_size.cols();
+		m_blasts.resize(rows + cols + rows * cols, bitboard(rows, cols));
+		for (size_t r = 0; r < rows; ++r) {
+			for (size_t c = 0; c < cols; ++c) {
+				const board_index i(r, c);
+				fill_blast(booster::type::horizontal, i, m_blasts[get_blast_index(booster::type::horizontal, i)]);
+				fill_blast(booster::type::vertical, i, m_blasts[get_blast_index(booster::type::vertical, i)]);
+				fill_blast(booster::type::radial, i, m_blasts[get_blast_index(booster::type::radial, i)]);
+			}
+		}
+	}
+
+public:
+	bool is_fixed() const noexcept override
+	{
+		return S::is_fixed;
+	}
+
+	void find_runs(const uint8_t* cells, bool vertical, runs& r) const override
+	{
+		//// rows and columns are walked with strides, so they share the loop
+		const size_t lines = vertical ? m_size.cols() : m_size.rows();
+		const size_t length = vertical ? m_size.rows() : m_size.cols();
+		const size_t step = vertical ? m_size.cols() : 1;
+		const size_t line_step = vertical ? 1 : m_size.cols();
+		for (size_t l = 0; l < lines; ++l) {
+			const uint8_t* p = cells + l * line_step;
+			size_t start = 0;
+			for (size_t k = 1; k <= length; ++k) {
+				if (k < length && p[k * step] == p[start * step]) {
+					continue;
+				}
+				if (k - start > 2 && is_figure(p[start * step])) {
+					r.push_back(std::make_pair(vertical ? board_index(start, l) : board_index(l, start), k - start));
+				}
+				start = k;
+			}
+		}
+	}
+
+	void find_drops(const uint8_t* cells, moves& m) const override
+	{
+		const size_t rows = m_size.rows();
+		const size_t cols = m_size.cols();
+		for (size_t c = 0; c < cols; ++c) {
+			//// the lowest free row is kept while going up, every item is moved there at once
+			size_t free_row = rows;
+			for (size_t r = rows; r-- > 0;) {
+				if (cells[r * cols + c] == cell().raw()) {
+					continue;
+				}
+				--free_row;
+				if (free_row != r) {
+					m.push_back(std::make_pair(board_index(r, c), board_index(free_row, c)));
+				}
+			}
+		}
+	}
+
+	void add_blast(const booster::type& t, const board_index& i, bitboard& out) const override
+	{
+		assert(out.rows() == m_size.rows() && out.columns() == m_size.cols());
+		assert(i.row() < m_size.rows() && i.column() < m_size.cols());
+		if (m_blasts.empty()) {
+			fill_blast(t, i, out);
+			return;
+		}
+		out |= m_blasts[get_blast_index(t, i)];
+	}
+
+private:
+	static bool is_figure(uint8_t v) noexcept
+	{
+		return (v & cell::kind_mask) == cell::figure_tag;
+	}
+
+	size_t get_blast_index(const booster::type& t, const board_index& i) const noexcept
+	{
+		switch (t) {
+			case booster::type::horizontal:
+				return i.row();
+			case booster::type::vertical:
+				return m_size.rows() + i.column();
+			case booster::type::radial:
+				break;
+		}
+		return m_size.rows() + m_size.cols() + i.row() * m_size.cols() + i.column();
+	}
+
+	void fill_blast(const booster::type& t, const board_index& i, bitboard& out) const
+	{
+		const size_t rows = m_size.rows();
+		const size_t cols = m_size.cols();
+		switch (t) {
+			case booster::type::horizontal:
+				for (size_t c = 0; c < cols; ++c) {
+					out.set(board_index(i.row(), c));
+				}
+				break;
+			case booster::type::vertical:
+				for (size_t r = 0; r < rows; ++r) {
+					out.set(board_index(r, i.column()));
+				}
+				break;
+			case booster::type::radial: {
+				const size_t first_row = i.row() == 0 ? 0 : i.row() - 1;
+				const size_t first_col = i.column() == 0 ? 0 : i.column() - 1;
+				const size_t last_row = std::min(i.row() + 1, rows - 1);
+				const size_t last_col = std::min(i.column() + 1, cols - 1);
+				for (size_t r = first_row; r <= last_row; ++r) {
+					for (size_t c = first_col; c <= last_col; ++c) {
+						out.set(board_index(r, c));
+					}
+				}
+				break;
+			}
+		}
+	}
+
+private:
+	S m_size;
+	//// the precomputed areas of boosters, they are kept only for the specialized sizes
+	std::vector<bitboard> m_blasts;
+
+};
+
+constexpr size_t fixed_sizes_count = board_kernels::max_fixed_size - board_kernels::min_fixed_size + 1;
+
+template <size_t R, size_t C>
+const board_kernels& get_fixed()
+{
+	static const kernels<fixed_size<R, C>> k{ fixed_size<R, C>() };
+	return k;
+}
+
+template <size_t R>
+const board_kernels& get_fixed(size_t cols)
+{
+	switch (cols) {
+		case 7:
+			return get_fixed<R, 7>();
+		case 8:
+			return get_fixed<R, 8>();
+		case 9:
+			return get_fixed<R, 9>();
+	}
+	assert(cols == 10);
+	return get_fixed<R, 10>();
+}
+
+}
+
+const board_kernels& board_kernels::get(size_t rows, size_t cols)
+{
+	static_assert(fixed_sizes_count == 4, "update the instantiated sizes");
+	if (rows >= min_fixed_size && rows <= max_fixed_size && cols >= min_fixed_size && cols <= max_fixed_size) {
+		switch (rows) {
+			case 7:
+				return get_fixed<7>(cols);
+			case 8:
+				return get_fixed<8>(cols);
+			case 9:
+				return get_fixed<9>(cols);
+			case 10:
+				return get_fixed<10>(cols);
+		}
+	}
+	//// other sizes share kernels with runtime bounds
+	static std::mutex s_mutex;
+	static std::map<std::pair<size_t, size_t>, std::unique_ptr<board_kernels>> s_kernels;
+	std::lock_guard<std::mutex> lock(s_mutex);
+	std::unique_ptr<board_kernels>& k = s_kernels[std::make_pair(rows, cols)];
+	if (!k) {
+		k.reset(new kernels<runtime_size>(runtime_size{ rows, cols }));
+	}
+	return *k;
+}
@@ -0,0 +1,71 @@
+#ifndef CORE_BOARD_KERNELS_HPP
+#define CORE_BOARD_KERNELS_HPP
+
+#include "bitboard.hpp"
+#include "board_index.hpp"
+#include "boosters.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+
+//// @class board_kernels
+//// @brief Whole board kernels of the matcher, gravity and boosters which are specialized for the board size
+//// The kernels are templates on rows and columns count. They are instantiated for all board sizes
+//// which GUI allows (7 - 10 rows and columns), so the loops of these boards have compile time bounds
+//// and can be unrolled and vectorized by compiler. Other sizes use the same kernels with runtime bounds.
+//// The kernels are chosen once per board (see get()), so a call costs one virtual call per board, not per cell.
+//// @note The cells are raw cell values (see cell::raw()) in row-major order
+class board_kernels
+{
+public:
+	//// The (from, to) indexes of moved items
+	using moves = std::vector<std::pair<board_index, board_index>>;
+
+	//// The runs of same figures: the first (left or top) index and the cells count
+	using runs = std::vector<std::pair<board_index, size_t>>;
+
+	//// @brief The minimum rows or columns count of specialized kernels - 7
+	static constexpr size_t min_fixed_size = 7;
+
+	//// @brief The maximum rows or columns count of specialized kernels - 10
+	static constexpr size_t max_fixed_size = 10;
+
+public:
+	//// @brief Gets the kernels for given board size
+	//// @return The specialized kernels for 7 - 10 rows and columns or the kernels with runtime bounds
+	static const board_kernels& get(size_t rows, size_t cols);
+
+public:
+	//// @brief Destructor
+	virtual ~board_kernels() = default;
+
+public:
+	//// @brief Checks if the kernels are specialized for the board size
+	virtual bool is_fixed() const noexcept = 0;
+
+	//// @brief Finds the runs of at least 3 same figures in rows or columns
+	//// This is the board scan of horizontal_pattern and vertical_pattern.
+	//// @param[in] cells The board cells
+	//// @param[in] vertical Runs are searched in columns if true, in rows otherwise
+	//// @param[out] r The runs are appended line by line, the runs of a line from its start
+	virtual void find_runs(const uint8_t* cells, bool vertical, runs& r) const = 0;
+
+	//// @brief Finds the moves which drop items to empty cells below them
+	//// Columns are processed from left to right, the items of column from bottom to top.
+	//// @param[in] cells The board cells
+	//// @param[out] m The moves are appended in the order they should be done
+	virtual void find_drops(const uint8_t* cells, moves& m) const = 0;
+
+	//// @brief Adds the impact area of booster (without chaining) to given mask
+	//// The areas depend only on the booster type and index, so they are precomputed for the specialized sizes:
+	//// a mask per row, a mask per column and a 3x3 mask per cell. Then adding an area is one OR of masks.
+	//// @param[in] t The booster type
+	//// @param[in] i The booster index
+	//// @param[in,out] out The mask of impacted cells (the booster cell is included), it should have the board size
+	virtual void add_blast(const booster::type& t, const board_index& i, bitboard& out) const = 0;
+};
+
+#endif // CORE_BOARD_KERNELS_HPP
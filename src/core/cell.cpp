@@ -0,0 +1,67 @@
+
+#include "cell.hpp"
+
+#include <cassert>
+
+
+namespace {
+
+//// Shared views of cells. They keep no state except the kind, so one object per kind is enough
+figure* get_figure_view(const figure::color& c) noexcept
+{
+	static figure figures[figure::colors_count] = {
+		figure(figure::color::blue),
+		figure(figure::color::green),
+		figure(figure::color::orange),
+		figure(figure::color::red),
+		figure(figure::color::violet)
+	};
+	return &figures[static_cast<size_t>(c)];
+}
+
+booster* get_booster_view(const booster::type& t) noexcept
+{
+	static horizontal_bomb h_bomb;
+	static vertical_bomb v_bomb;
+	static radial_bomb r_bomb;
+	switch (t) {
+		case booster::type::horizontal:
+			return &h_bomb;
+		case booster::type::vertical:
+			return &v_bomb;
+		case booster::type::radial:
+			return &r_bomb;
+	}
+	return nullptr;
+}
+
+}
+
+
+cell cell::from_color(const figure::color& c) noexcept
+{
+	assert(c != figure::color::UNDEFINED);
+	assert(static_cast<size_t>(c) < figure::colors_count);
+	return cell(static_cast<uint8_t>(figure_tag | static_cast<uint8_t>(c)));
+}
+
+cell cell::from_booster(const booster::type& t) noexcept
+{
+	return cell(static_cast<uint8_t>(booster_tag | static_cast<uint8_t>(t)));
+}
+
+booster::type cell::get_booster_type() const noexcept
+{
+	assert(is_booster());
+	return static_cast<booster::type>(m_value & payload_mask);
+}
+
+board_item* cell::get_item() const noexcept
+{
+	if (is_figure()) {
+		return get_figure_view(get_color());
+	} else if (is_booster()) {
+		return get_booster_view(get_booster_type());
+	}
+	return nullptr;
+}
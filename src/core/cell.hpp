@@ -0,0 +1,110 @@
+#ifndef CORE_CELL_HPP
+#define CORE_CELL_HPP
+
+#include "boosters.hpp"
+#include "figure.hpp"
+
+#include <cstdint>
+
+
+class board_item;
+
+
+//// @class cell
+//// @brief Compact value type of a board cell
+//// One byte keeps the cell kind (empty, figure or booster) and its payload (figure color or booster type).
+//// Board keeps cells inline, so copying a board is copying a flat byte array.
+//// @note board_item objects are only views of cells (see get_item()), they are not owned by board
+class cell
+{
+public:
+	//// @brief The bits of raw value which keep the cell kind
+	static constexpr uint8_t kind_mask = 0xf0;
+
+	//// @brief The cell kind bits of figures
+	//// @note Used by vectorized checks which work with raw values (see line_kernel)
+	static constexpr uint8_t figure_tag = 0x10;
+
+public:
+	//// @brief Creates a figure cell with given color
+	static cell from_color(const figure::color&) noexcept;
+
+	//// @brief Creates a booster cell with given type
+	static cell from_booster(const booster::type&) noexcept;
+
+public:
+	//// @brief Constructor
+	//// @note Creates an empty cell
+	constexpr cell() noexcept
+		: m_value(empty_tag)
+	{
+	}
+
+public:
+	//// @brief Checks if the cell is empty or not
+	bool is_empty() const noexcept
+	{
+		return m_value == empty_tag;
+	}
+
+	//// @brief Checks if the cell keeps a figure or not
+	bool is_figure() const noexcept
+	{
+		return (m_value & kind_mask) == figure_tag;
+	}
+
+	//// @brief Checks if the cell keeps a booster or not
+	bool is_booster() const noexcept
+	{
+		return (m_value & kind_mask) == booster_tag;
+	}
+
+	//// @brief Gets the figure's color
+	//// @return figure::color::UNDEFINED if the cell doesn't keep a figure
+	figure::color get_color() const noexcept
+	{
+		return is_figure() ? static_cast<figure::color>(m_value & payload_mask) : figure::color::UNDEFINED;
+	}
+
+	//// @brief Gets the booster's type
+	//// @note The cell should keep a booster
+	booster::type get_booster_type() const noexcept;
+
+	//// @brief Gets the raw byte of the cell
+	//// @note Figures with same colors have same raw values
+	uint8_t raw() const noexcept
+	{
+		return m_value;
+	}
+
+	//// @brief Gets the board item view of the cell
+	//// @return shared figure or booster object for the cell's kind, nullptr for empty cell
+	board_item* get_item() const noexcept;
+
+public:
+	bool operator== (const cell& c) const noexcept
+	{
+		return m_value == c.m_value;
+	}
+
+	bool operator!= (const cell& c) const noexcept
+	{
+		return m_value != c.m_value;
+	}
+
+private:
+	static constexpr uint8_t empty_tag = 0x00;
+	static constexpr uint8_t booster_tag = 0x20;
+	static constexpr uint8_t payload_mask = 0x0f;
+
+	explicit constexpr cell(uint8_t v) noexcept
+		: m_value(v)
+	{
+	}
+
+private:
+	uint8_t m_value;
+
+};
+
+#endif // CORE_CELL_HPP
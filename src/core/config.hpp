@@ -2,9 +2,11 @@
 #ifndef CORE_CONFIG_HPP
 #define CORE_CONFIG_HPP
 
+#include "boosters.hpp"
 #include "figure.hpp"
 #include "objective.hpp"
 
+#include <cstdint>
 #include <string>
 #include <vector>
 
@@ -16,13 +18,17 @@
 //// @class config
 //// @brief Loads the game configuration from given JSON file
 //// Given JSON file should have the following fields
-////	* Board (7 - 10)
+////	* Board (7 - 255, GUI allows 7 - 10)
 ////		* Rows - <INTEGER>
 ////		* Cols - <INTEGER>
 ////	* Moves
 ////	* Objectives (1 - 3)
 ////		* <COLORS> - <INTEGER>
 ////	* Colors (3 - 5)
+////	* Patterns (optional) - the level's shapes, they have priority over the built-in patterns
+////		* Shape - <ARRAY OF STRINGS> (see shape_pattern)
+////		* Booster - Horizontal, Vertical, Radial or None (the default)
+////	* Seed (optional) - <INTEGER> the seed of random generator, the game is different every run without it
 class config
 {
 public:
@@ -39,8 +45,19 @@ private:
     };
 
 
+public:
+	//// @struct shape
+	//// @brief The level's pattern shape holder
+	struct shape
+	{
+		std::vector<std::string> rows;
+		bool has_booster = false;
+		booster::type booster_type = booster::type::radial;
+	};
+
 public:
     using objectives_t = std::vector<std::pair<figure::color, size_t>>;
+    using shapes_t = std::vector<shape>;
     using ptr = std::unique_ptr<config>;
 
 public:
@@ -74,6 +91,16 @@ public:
     //// @brief Gets the objectives
     void get_objectives(objectives_t&) const noexcept;
 
+    //// @brief Gets the level's pattern shapes
+    void get_shapes(shapes_t&) const noexcept;
+
+    //// @brief Checks if the seed of random generator is specified
+    bool has_seed() const noexcept;
+
+    //// @brief Gets the seed of random generator
+    //// @note It is 0 if the seed isn't specified
+    uint64_t get_seed() const noexcept;
+
 private:
     void init(const std::string&);
 
@@ -81,6 +108,8 @@ private:
     void load_objectives(const boost::property_tree::ptree&);
     void load_moves_count(const boost::property_tree::ptree&);
     void load_figures_colors_count(const boost::property_tree::ptree&);
+    void load_shapes(const boost::property_tree::ptree&);
+    void load_seed(const boost::property_tree::ptree&);
 
     bool is_valid_board_size() const noexcept;
     bool is_valid_moves_count() const noexcept;
@@ -98,6 +127,9 @@ private:
     size_t m_moves_count = 0;
     size_t m_figure_colors_count = 0;
     objectives_t m_objectives;
+    shapes_t m_shapes;
+    bool m_has_seed = false;
+    uint64_t m_seed = 0;
 
 };
 
@@ -1,533 +1,537 @@
-
-#include "board.hpp"
-#include "boosters.hpp"
-#include "config.hpp"
-#include "exceptions.hpp"
-#include "game_controller.hpp"
-#include "matcher.hpp"
-#include "match_data.hpp"
-#include "notifier.hpp"
-#include "patterns.hpp"
-
-#include <algorithm>
-#include <list>
-#include <cassert>
-#include <ctime>
-#include <iostream>
-
-
-
-game_controller* game_controller::s_game_controller = nullptr;
-
-
-void game_controller::create()
-{
-	s_game_controller = new game_controller;
-}
-
-void game_controller::destroy()
-{
-	assert(s_game_controller != nullptr);
-    delete s_game_controller;
-	s_game_controller = nullptr;
-}
-
-game_controller* game_controller::get()
-{
-	assert(s_game_controller != nullptr);
-	return s_game_controller;
-}
-
-game_controller::game_controller()
-{
-    init();
-    notifier::create();
-    notifier::get()->add_listener(m_objectives.get());
-	notifier::get()->add_listener(this);
-}
-
-game_controller::~game_controller()
-{
-	notifier::get()->remove_listener(m_objectives.get());
-	notifier::get()->remove_listener(this);
-    assert(m_config);
-    m_config.reset();
-    assert(m_matcher);
-    m_matcher.reset();
-    assert(m_board);
-    m_board.reset();
-    assert(m_objectives);
-    m_objectives.reset();
-    notifier::destroy();
-}
-
-void game_controller::init()
-{
-    load_config();
-    init_patterns();
-    m_board = board::ptr(new board(m_config->get_rows(), m_config->get_cols()));
-    m_objectives = objectives::ptr(new objectives(m_config));
-
-    m_moves_count = m_config->get_moves_count();
-    m_figure_colors_count = m_config->get_figures_count();
-    for (size_t i = 0; i < m_figure_colors_count; ++i) {
-        m_color_types.push_back(static_cast<figure::color>(i));
-    }
-    init_booster_types();
-}
-
-void game_controller::init_booster_types()
-{
-    m_booster_types = {
-        std::make_pair(pattern::type::horizontal, booster::type::vertical),
-        std::make_pair(pattern::type::vertical, booster::type::horizontal),
-        std::make_pair(pattern::type::radial, booster::type::radial),
-        std::make_pair(pattern::type::t, booster::type::radial)
-    };
-}
-
-void game_controller::init_patterns()
-{
-    m_matcher = matcher::ptr(new matcher);
-    m_matcher->add_pattern(new t_pattern);
-    m_matcher->add_pattern(new radial_pattern);
-    m_matcher->add_pattern(new horizontal_pattern);
-    m_matcher->add_pattern(new vertical_pattern);
-}
-
-void game_controller::start_game()
-{
-    fill_board();
-	update_game_status(game_status::in_progress);
-}
-
-void game_controller::load_config()
-{
-    m_config = config::ptr(new config);
-    m_config->load("../../../resources/CONFIG.JSON");
-    assert(m_config->is_valid());
-}
-
-void game_controller::on_objectives_completed() noexcept
-{
-	update_game_status(game_status::passed);
-}
-
-game_controller::game_status game_controller::get_game_status() const noexcept
-{
-	return m_game_status;
-}
-
-void game_controller::update_game_status(const game_status s) noexcept
-{
-	if (s == game_status::not_started) {
-		m_game_status = s;
-	}
-	if (m_game_status == game_status::not_started && s == game_status::in_progress) {
-		m_game_status = s;
-		return;
-	}
-	if (m_game_status == game_status::in_progress) {
-		m_game_status = s;
-		notifier* n = notifier::get();
-		assert(n != nullptr);
-		switch (m_game_status) {
-			case game_status::failed: {
-				n->on_level_failed();
-			} break;
-			case game_status::passed: {
-				n->on_level_passed();
-			} break;
-			default:;
-		}
-	}
-}
-
-size_t game_controller::get_rows() const noexcept
-{
-    assert(m_board);
-    return m_board->rows();
-}
-
-size_t game_controller::get_cols() const noexcept
-{
-    assert(m_board.get() != nullptr);
-    return m_board->columns();
-}
-
-size_t game_controller::get_moves_count() const noexcept
-{
-	return m_moves_count;
-}
-
-board_item* game_controller::get_board_item(const index& i) const noexcept
-{
-	return m_board->get_item(i);
-}
-
-void game_controller::get_objectives(std::vector<objective*>& o) const noexcept
-{
-	assert(m_objectives != nullptr);
-	m_objectives->get_objectives(o);
-}
-
-void game_controller::swap(const index& i1, const index& i2)
-{
-    assert(i1.is_valid());
-    assert(i2.is_valid());
-    assert(can_swap(i1, i2));
-    m_board->swap(i1, i2);
-	notifier::get()->on_items_swapped(i1, i2);
-}
-
-bool game_controller::can_swap(const index& i1, const index& i2) const noexcept
-{
-    if (!i1.is_valid() || !i2.is_valid()) {
-        return false;
-    }
-    assert(m_board);
-    return m_board->can_swap(i1, i2);
-}
-
-void game_controller::process_selection(const index& i)
-{
-	//// specified index should be valid
-	if (!i.is_valid()) {
-		return;
-	}
-	//// if selection is empty select item
-	if (!m_selected_index.is_valid()) {
-		m_selected_index = i;
-		return;
-	}
-	//// booster should be activated after clicking on it twice
-	if (!can_swap(m_selected_index, i)) {
-		if (m_selected_index == i) {
-			board_item* item = m_board->get_item(m_selected_index);
-			if (item->is_booster()) {
-				activate_booster(dynamic_cast<booster*>(item), m_selected_index);
-				drop_new_items();
-				decrease_moves_count();
-			}
-		}
-		m_selected_index = invalid_index;
-		return;
-	}
-	//// swap two items
-	swap(m_selected_index, i);
-	board_item* item1 = m_board->get_item(m_selected_index);
-	board_item* item2 = m_board->get_item(i);
-	assert(item1 != nullptr);
-	assert(item2 != nullptr);
-	//// swapping two boosters doesn't allowed
-	if (item1->is_booster() && item2->is_booster()) {
-		swap(m_selected_index, i);
-		m_selected_index = invalid_index;
-		return;
-	}
-	//// activate booster if one of swapping items is booster
-	if (item1->is_booster()) {
-		activate_booster(dynamic_cast<booster*>(item1), m_selected_index);
-		match_data md;
-		const bool matched = match(m_selected_index, md);
-		if (matched) {
-			process_matching(i, md);
-		}
-		drop_new_items();
-		decrease_moves_count();
-		m_selected_index = invalid_index;
-		return;
-	}
-	if (item2->is_booster()) {
-		activate_booster(dynamic_cast<booster*>(item2), i);
-		match_data md;
-		const bool matched = match(m_selected_index, md);
-		if (matched) {
-			process_matching(i, md);
-		}
-		drop_new_items();
-		decrease_moves_count();
-		m_selected_index = invalid_index;
-		return;
-	}
-	//// match items
-	match_data md;
-	std::list<index> mi;
-	bool matched_first = match(m_selected_index, md);
-	if (matched_first) {
-		process_matching(m_selected_index, md);
-	}
-	md.reset();
-	bool matched_second = match(i, md);
-	if (matched_second) {
-		process_matching(i, md);
-	}
-	//// items should be swapped back if nothing happpens after swap
-	if (!matched_first && !matched_second) {
-		swap(m_selected_index, i);
-		m_selected_index = invalid_index;
-		return;
-	}
-	//// process
-	drop_new_items();
-	decrease_moves_count();
-	m_selected_index = invalid_index;
-}
-
-bool game_controller::match(const index& i, match_data& md)
-{
-	assert(m_board);
-	assert(m_matcher);
-	if (!i.is_valid()) {
-		return false;
-	}
-	return m_matcher->match(m_board, i, md);
-}
-
-bool game_controller::proxy_match(const index& i1, const index& i2) const
-{
-	assert(m_board);
-	assert(m_matcher);
-	return m_matcher->proxy_match(m_board, i1, i2);
-}
-
-void game_controller::activate_booster(booster* b, const index& i)
-{
-	assert(b != nullptr);
-	std::set<index> impact_areas;
-	b->activate(m_board, i, impact_areas);
-	std::list<index> destroyed_items(std::begin(impact_areas), std::end(impact_areas));
-	notifier::get()->on_items_destroyed(destroyed_items);
-	std::set<int> impact_cols;
-	for (auto it : impact_areas) {
-		impact_cols.insert(it.column());
-	}
-	drop_columns(impact_cols);
-}
-
-void game_controller::process_matching(const index& i, const match_data& md)
-{
-	std::list<index> mi;
-	md.get_indexes(mi);
-	for (auto it : mi) {
-		m_board->destroy_item(it);
-	}
-	//// Notifies about destroyed items
-	notifier::get()->on_items_destroyed(mi);
-
-	if (mi.size() > 3) {
-		booster* b = create_booster(m_booster_types[md.get_pattern_type()]);
-		m_board->add_item(b, i);
-		notifier::get()->on_booster_created(b, i);
-	}
-
-	std::set<size_t> unique_dropped_indexes;
-	std::list<index> dropped_indexes;
-	for (auto it : mi) {
-		m_board->drop_column(it.column(), dropped_indexes);
-		unique_dropped_indexes.insert(it.column());
-	}
-	std::list<size_t> di(std::begin(unique_dropped_indexes), std::end(unique_dropped_indexes));
-	notifier::get()->on_columns_dropped(di);
-	
-
-	for (auto it : dropped_indexes) {
-		board_item* item = m_board->get_item(it);
-		if (!item) {
-			continue;
-		}
-		match_data md;
-		std::list<index> mi;
-		bool matched = m_matcher->match(m_board, it, md);
-		if (matched) {
-			md.get_indexes(mi);
-			std::set<int> drop_indexes;
-			for (auto it : mi) {
-				m_board->destroy_item(it);
-				drop_indexes.insert(it.column());
-			}
-			notifier::get()->on_items_destroyed(mi);
-			if (mi.size() > 3) {
-				booster* b = create_booster(m_booster_types[md.get_pattern_type()]);
-				m_board->add_item(b, it);
-				notifier::get()->on_booster_created(b, i);
-			}
-			drop_columns(drop_indexes);
-		}
-	}
-}
-
-void game_controller::drop_columns(const std::set<int>& column_indexes)
-{
-	assert(m_board);
-	if (column_indexes.empty()) {
-		return;
-	}
-	for (int i : column_indexes) {
-		m_board->drop_column(i);
-	}
-	std::list<size_t> di(std::begin(column_indexes), std::end(column_indexes));
-	notifier::get()->on_columns_dropped(di);
-}
-
-void game_controller::find_matchings_and_destroy()
-{
-	assert(m_board);
-	notifier* n = notifier::get();
-	assert(n != nullptr);
-	const size_t rows = m_board->rows();
-	const size_t cols = m_board->columns();
-	for (size_t r = 0; r <rows; ++r) {
-		for (size_t c = 0; c < cols; ++c) {
-			index current_index = index(r, c);
-			match_data md;
-			board_item* item = m_board->get_item(current_index);
-			if (!item) {
-				continue;
-			}
-			bool matched = m_matcher->match(m_board, current_index, md);
-			if (matched) {
-				std::list<index> mi;
-				md.get_indexes(mi);
-				std::set<int> drop_cols;
-				for (auto it : mi) {
-					m_board->destroy_item(it);
-					drop_cols.insert(it.column());
-				}
-				n->on_items_destroyed(mi);
-				if (mi.size() > 3) {
-					booster* b = create_booster(m_booster_types[md.get_pattern_type()]);
-					m_board->add_item(b, current_index);
-					n->on_booster_created(b, current_index);
-				}
-				for (auto it : drop_cols) {
-					std::list<index> tmp_i;
-					m_board->drop_column(it, tmp_i);
-				}
-				std::list<size_t> di(std::begin(drop_cols), std::end(drop_cols));
-				n->on_columns_dropped(di);
-			}
-		}
-	}
-}
-
-void game_controller::drop_new_items()
-{
-	std::list<index> empty_tiles;
-	m_board->get_empty_tiles(empty_tiles);
-	while (!empty_tiles.empty()) {
-		std::list<std::pair<figure*, index>> new_items_data;
-		for (auto it : empty_tiles) {
-			figure* f = new figure(figure::color(rand() % m_figure_colors_count));
-			m_board->add_item(f, it);
-			new_items_data.push_back(std::make_pair(f, it));
-		}
-		notifier::get()->on_new_items_dropped(new_items_data);
-		find_matchings_and_destroy();
-		empty_tiles.clear();
-		m_board->get_empty_tiles(empty_tiles);
-	}
-	//// Shuffle if there are no any moves
-	if (!moves_available()) {
-		shuffle();
-	}
-}
-
-void game_controller::fill_board()
-{
-    srand(time(0));
-	const size_t rows = m_board->rows();
-	const size_t cols = m_board->columns();
-    for (size_t i = 0; i < rows; ++i) {
-        for (size_t j = 0; j < cols; ++j) {
-			board_item* item = m_board->get_item(index(i, j));
-			if (item != nullptr) {
-				continue;
-			}
-			bool matched = true;
-			while (matched) {
-				figure* f = new figure(figure::color(rand() % m_figure_colors_count));
-				m_board->add_item(f, index(i, j));
-				match_data md;
-				matched = m_matcher->match(m_board, index(i, j), md);
-				if (matched) {
-					m_board->destroy_item(index(i, j));
-					figure* f = new figure(figure::color(rand() % m_figure_colors_count));
-					m_board->add_item(f, index(i, j));
-				}
-			}
-        }
-    }
-	if (!moves_available()) {
-		shuffle();
-	}
-}
-
-void game_controller::shuffle()
-{
-	//// XXX TODO INFINITE LOOP ???
-	//// NEED TO CHECK IF CAN'T FIND ANY MOVES EVEN SHUFFLING BOARD
-	while (true) {
-		m_board->shuffle();
-		notifier::get()->on_shuffle();
-		find_matchings_and_destroy();
-		drop_new_items();
-		if (moves_available()) {
-			break;
-		}
-	}
-}
-
-booster* game_controller::create_booster(const booster::type& bt) noexcept
-{
-    switch (bt) {
-        case booster::type::horizontal:
-            return new horizontal_bomb;
-        case booster::type::vertical:
-            return new vertical_bomb;
-        case booster::type::radial:
-            return new radial_bomb;
-    }
-    return nullptr;
-}
-
-void game_controller::decrease_moves_count()
-{
-	assert(m_moves_count);
-	--m_moves_count;
-	if (m_moves_count == 0) {
-		update_game_status(game_status::failed);
-	}
-}
-
-bool game_controller::moves_available()
-{
-	assert(m_board);
-	const size_t rows = m_board->rows();
-	const size_t cols = m_board->columns();
-	//// first check boosters
-	for (size_t r = 0; r < rows; ++r) {
-		for (size_t c = 0; c < cols; ++c) {
-			board_item* item = m_board->get_item(index(r, c));
-			if (item != nullptr && item->is_booster()) {
-				return true;
-			}
-		}
-	}
-	//// swap items with right and bottom neighbours and try match
-	match_data md;
-	for (size_t r = 0; r < rows; ++r) {
-		for (size_t c = 0; c < cols; ++c) {
-			index current(r, c);
-			index right(r, c + 1);
-			if (right.is_valid() && proxy_match(current, right)) {
-				return true;
-			}
-			index bottom(r + 1, c);
-			if (bottom.is_valid() && proxy_match(current, bottom)) {
-				return true;
-			}
-		}
-	}
-	return false;
-}
+
+#include "board.hpp"
+#include "boosters.hpp"
+#include "cell.hpp"
+#include "config.hpp"
+#include "exceptions.hpp"
+#include "game_controller.hpp"
+#include "matcher.hpp"
+#include "match_data.hpp"
+#include "notifier.hpp"
+#include "patterns.hpp"
+
+#include <algorithm>
+#include <list>
+#include <cassert>
+#include <iostream>
+
+
+
+game_controller* game_controller::s_game_controller = nullptr;
+
+const std::string game_controller::DEFAULT_CONFIG_FILE = "../../../resources/CONFIG.JSON";
+
+
+void game_controller::create(const std::string& f)
+{
+	s_game_controller = new game_controller(f);
+}
+
+void game_controller::destroy()
+{
+	assert(s_game_controller != nullptr);
+    delete s_game_controller;
+	s_game_controller = nullptr;
+}
+
+game_controller* game_controller::get()
+{
+	assert(s_game_controller != nullptr);
+	return s_game_controller;
+}
+
+game_controller::game_controller(const std::string& f)
+{
+    init(f);
+    notifier::create();
+    notifier::get()->add_listener(m_objectives.get());
+	notifier::get()->add_listener(this);
+}
+
+game_controller::~game_controller()
+{
+	notifier::get()->remove_listener(m_objectives.get());
+	notifier::get()->remove_listener(this);
+    assert(m_config);
+    m_config.reset();
+    m_evaluator.reset();
+    assert(m_matcher);
+    m_matcher.reset();
+    assert(m_moves);
+    m_moves.reset();
+    assert(m_board);
+    m_board.reset();
+    assert(m_objectives);
+    m_objectives.reset();
+    notifier::destroy();
+}
+
+void game_controller::init(const std::string& f)
+{
+    load_config(f);
+    init_patterns();
+    m_board = board::ptr(new board(m_config->get_rows(), m_config->get_cols()));
+    m_moves = move_set::ptr(new move_set(m_config->get_rows(), m_config->get_cols()));
+    m_objectives = objectives::ptr(new objectives(m_config));
+
+    m_moves_count = m_config->get_moves_count();
+    m_figure_colors_count = m_config->get_figures_count();
+    for (size_t i = 0; i < m_figure_colors_count; ++i) {
+        m_color_types.push_back(static_cast<figure::color>(i));
+    }
+}
+
+void game_controller::init_patterns()
+{
+    assert(m_config);
+    m_matcher = matcher::ptr(new matcher);
+    //// the shapes of the level have priority over the built-in patterns
+    config::shapes_t shapes;
+    m_config->get_shapes(shapes);
+    for (const auto& it : shapes) {
+        if (it.has_booster) {
+            m_matcher->add_pattern(pattern::ptr(new shape_pattern(it.rows, it.booster_type)));
+        } else {
+            m_matcher->add_pattern(pattern::ptr(new shape_pattern(it.rows)));
+        }
+    }
+    m_matcher->add_pattern(pattern::ptr(new shape_pattern(shapes::t_shape, booster::type::radial, pattern::type::t)));
+    m_matcher->add_pattern(pattern::ptr(new shape_pattern(shapes::square, booster::type::radial, pattern::type::radial)));
+    m_matcher->add_pattern(pattern::ptr(new horizontal_pattern));
+    m_matcher->add_pattern(pattern::ptr(new vertical_pattern));
+    m_matcher->set_mode(matcher::mode::lookup);
+}
+
+void game_controller::start_game()
+{
+    assert(m_config);
+    start_game(m_config->has_seed() ? m_config->get_seed() : rng::make_seed());
+}
+
+void game_controller::start_game(uint64_t seed)
+{
+    if (m_game_status != game_status::not_started) {
+        reset_game();
+    }
+    m_rng = game_rng::ptr(new game_rng(seed));
+    fill_board();
+	update_game_status(game_status::in_progress);
+}
+
+void game_controller::reset_game()
+{
+    assert(m_config);
+    assert(m_objectives);
+    m_board = board::ptr(new board(m_config->get_rows(), m_config->get_cols()));
+    m_moves = move_set::ptr(new move_set(m_config->get_rows(), m_config->get_cols()));
+    m_objectives->reset(m_config);
+    m_moves_count = m_config->get_moves_count();
+    m_selected_index = invalid_index;
+    m_cascade.clear();
+    update_game_status(game_status::not_started);
+}
+
+uint64_t game_controller::get_seed() const noexcept
+{
+    assert(m_rng);
+    return m_rng->get_seed();
+}
+
+void game_controller::load_config(const std::string& f)
+{
+    m_config = config::ptr(new config);
+    m_config->load(f);
+    assert(m_config->is_valid());
+}
+
+void game_controller::on_objectives_completed() noexcept
+{
+	update_game_status(game_status::passed);
+}
+
+game_controller::game_status game_controller::get_game_status() const noexcept
+{
+	return m_game_status;
+}
+
+void game_controller::update_game_status(const game_status s) noexcept
+{
+	if (s == game_status::not_started) {
+		m_game_status = s;
+	}
+	if (m_game_status == game_status::not_started && s == game_status::in_progress) {
+		m_game_status = s;
+		return;
+	}
+	if (m_game_status == game_status::in_progress) {
+		m_game_status = s;
+		notifier* n = notifier::get();
+		assert(n != nullptr);
+		switch (m_game_status) {
+			case game_status::failed: {
+				n->on_level_failed();
+			} break;
+			case game_status::passed: {
+				n->on_level_passed();
+			} break;
+			default:;
+		}
+	}
+}
+
+size_t game_controller::get_rows() const noexcept
+{
+    assert(m_board);
+    return m_board->rows();
+}
+
+size_t game_controller::get_cols() const noexcept
+{
+    assert(m_board.get() != nullptr);
+    return m_board->columns();
+}
+
+size_t game_controller::get_moves_count() const noexcept
+{
+	return m_moves_count;
+}
+
+board_item* game_controller::get_board_item(const board_index& i) const noexcept
+{
+	return m_board->get_item(i);
+}
+
+void game_controller::get_objectives(std::vector<objective*>& o) const noexcept
+{
+	assert(m_objectives != nullptr);
+	m_objectives->get_objectives(o);
+}
+
+void game_controller::swap(const board_index& i1, const board_index& i2)
+{
+    assert(m_board->contains(i1));
+    assert(m_board->contains(i2));
+    assert(can_swap(i1, i2));
+    m_board->swap(i1, i2);
+	notifier::get()->on_items_swapped(i1, i2);
+}
+
+bool game_controller::can_swap(const board_index& i1, const board_index& i2) const noexcept
+{
+    assert(m_board);
+    if (!m_board->contains(i1) || !m_board->contains(i2)) {
+        return false;
+    }
+    return m_board->can_swap(i1, i2);
+}
+
+void game_controller::process_selection(const board_index& i)
+{
+	//// specified index should be valid
+	if (!m_board->contains(i)) {
+		return;
+	}
+	//// if selection is empty select item
+	if (!m_selected_index.is_valid()) {
+		m_selected_index = i;
+		return;
+	}
+	//// booster should be activated after clicking on it twice
+	if (!can_swap(m_selected_index, i)) {
+		if (m_selected_index == i) {
+			const cell item = m_board->get_cell(m_selected_index);
+			if (item.is_booster()) {
+				m_cascade.clear();
+				activate_booster(m_selected_index);
+				matcher::matches matches;
+				run_cascade(matches);
+				ensure_moves();
+				decrease_moves_count();
+			}
+		}
+		m_selected_index = invalid_index;
+		return;
+	}
+	//// swap two items
+	swap(m_selected_index, i);
+	const cell item1 = m_board->get_cell(m_selected_index);
+	const cell item2 = m_board->get_cell(i);
+	assert(!item1.is_empty());
+	assert(!item2.is_empty());
+	//// swapping two boosters doesn't allowed
+	if (item1.is_booster() && item2.is_booster()) {
+		swap(m_selected_index, i);
+		m_selected_index = invalid_index;
+		return;
+	}
+	m_cascade.clear();
+	//// activate booster if one of swapping items is booster
+	if (item1.is_booster() || item2.is_booster()) {
+		activate_booster(item1.is_booster() ? m_selected_index : i);
+		matcher::matches matches;
+		run_cascade(matches);
+		ensure_moves();
+		decrease_moves_count();
+		m_selected_index = invalid_index;
+		return;
+	}
+	//// match items, both matches are found before destroying, so they are processed together
+	matcher::matches matches;
+	match_data md;
+	if (match(m_selected_index, md)) {
+		matches.push_back(std::make_pair(m_selected_index, md));
+	}
+	md.reset();
+	if (match(i, md)) {
+		matches.push_back(std::make_pair(i, md));
+	}
+	//// items should be swapped back if nothing happpens after swap
+	if (matches.empty()) {
+		swap(m_selected_index, i);
+		m_selected_index = invalid_index;
+		return;
+	}
+	//// process
+	run_cascade(matches);
+	ensure_moves();
+	decrease_moves_count();
+	m_selected_index = invalid_index;
+}
+
+bool game_controller::match(const board_index& i, match_data& md)
+{
+	assert(m_board);
+	assert(m_matcher);
+	if (!m_board->contains(i)) {
+		return false;
+	}
+	return m_matcher->match(m_board, i, md);
+}
+
+void game_controller::activate_booster(const board_index& i)
+{
+	assert(m_board);
+	assert(m_board->get_cell(i).is_booster());
+	//// the activation is the first cascade step, it has no matches
+	//// the chain is resolved by the board, the same as for get_booster_impact()
+	bitboard impact_areas(m_board->rows(), m_board->columns());
+	m_board->get_chain_mask(i, impact_areas);
+	cascade_step step;
+	step.cleared.reserve(impact_areas.count());
+	impact_areas.for_each([&step](const board_index& it) {
+		step.cleared.push_back(it);
+	});
+	clear_stage(step);
+	gravity_stage(step);
+	refill_stage(step);
+	m_cascade.push_back(std::move(step));
+}
+
+void game_controller::run_cascade(matcher::matches& m)
+{
+	assert(m_board);
+	assert(m_matcher);
+	matcher::resolution r;
+	while (true) {
+		//// detect: the first matches can be given by caller, the others are found on the settled board
+		if (m.empty()) {
+			m_matcher->find_all(m_board, m);
+		}
+		if (m.empty()) {
+			break;
+		}
+		cascade_step step;
+		step.matches_count = m.size();
+		//// resolve: overlapping matches are merged, so every cell is cleared once
+		r.cleared.clear();
+		r.boosters.clear();
+		m_matcher->resolve(m_board, m, r);
+		step.cleared.swap(r.cleared);
+		step.boosters.swap(r.boosters);
+		clear_stage(step);
+		boosters_stage(step);
+		gravity_stage(step);
+		refill_stage(step);
+		m_cascade.push_back(std::move(step));
+		m.clear();
+	}
+}
+
+void game_controller::clear_stage(cascade_step& step)
+{
+	for (const auto& it : step.cleared) {
+		destroy_item(it);
+	}
+	notifier::get()->on_items_destroyed(step.cleared);
+}
+
+void game_controller::boosters_stage(cascade_step& step)
+{
+	notifier* n = notifier::get();
+	for (const auto& it : step.boosters) {
+		const cell b = create_booster(it.second);
+		m_board->add_item(b, it.first);
+		n->on_booster_created(static_cast<booster*>(b.get_item()), it.first);
+	}
+}
+
+void game_controller::gravity_stage(cascade_step& step)
+{
+	//// all columns are dropped at once
+	m_board->drop_items(step.drops);
+	notifier::get()->on_items_dropped(step.drops);
+}
+
+void game_controller::refill_stage(cascade_step& step)
+{
+	//// after gravity the empty cells are on the top of columns, so all of them are filled at once
+	//// the mask is copied, because adding items changes the board's empty mask
+	const bitboard empty_tiles = m_board->get_empty_mask();
+	empty_tiles.for_each([this, &step](const board_index& i) {
+		const cell f = create_figure(game_rng::stream::refill);
+		m_board->add_item(f, i);
+		step.new_items.push_back(std::make_pair(static_cast<figure*>(f.get_item()), i));
+	});
+	notifier::get()->on_new_items_dropped(step.new_items);
+}
+
+void game_controller::ensure_moves()
+{
+	if (!moves_available()) {
+		shuffle();
+	}
+}
+
+void game_controller::fill_board()
+{
+	const size_t rows = m_board->rows();
+	const size_t cols = m_board->columns();
+    for (size_t i = 0; i < rows; ++i) {
+        for (size_t j = 0; j < cols; ++j) {
+			if (!m_board->get_cell(board_index(i, j)).is_empty()) {
+				continue;
+			}
+			bool matched = true;
+			while (matched) {
+				m_board->add_item(create_figure(game_rng::stream::generation), board_index(i, j));
+				match_data md;
+				matched = m_matcher->match(m_board, board_index(i, j), md);
+				if (matched) {
+					m_board->destroy_item(board_index(i, j));
+					m_board->add_item(create_figure(game_rng::stream::generation), board_index(i, j));
+				}
+			}
+        }
+    }
+	if (!moves_available()) {
+		shuffle();
+	}
+}
+
+void game_controller::shuffle()
+{
+	//// XXX TODO INFINITE LOOP ???
+	//// NEED TO CHECK IF CAN'T FIND ANY MOVES EVEN SHUFFLING BOARD
+	matcher::matches matches;
+	do {
+		m_board->shuffle(m_rng->get(game_rng::stream::shuffle));
+		notifier::get()->on_shuffle();
+		run_cascade(matches);
+	} while (!moves_available());
+}
+
+cell game_controller::create_figure(const game_rng::stream& s) noexcept
+{
+	assert(m_rng);
+	return cell::from_color(figure::color(m_rng->get(s).next_below(static_cast<uint32_t>(m_figure_colors_count))));
+}
+
+cell game_controller::create_booster(const booster::type& bt) noexcept
+{
+    return cell::from_booster(bt);
+}
+
+void game_controller::destroy_item(const board_index& i)
+{
+	assert(m_board);
+	const cell destroyed = m_board->destroy_item(i);
+	if (destroyed.is_figure()) {
+		notifier::get()->on_figure_destroyed(static_cast<figure*>(destroyed.get_item()));
+	}
+}
+
+void game_controller::decrease_moves_count()
+{
+	assert(m_moves_count);
+	--m_moves_count;
+	if (m_moves_count == 0) {
+		update_game_status(game_status::failed);
+	}
+}
+
+bool game_controller::moves_available()
+{
+	assert(m_board);
+	//// first check boosters
+	for (size_t t = 0; t < booster::types_count; ++t) {
+		if (m_board->get_booster_mask(static_cast<booster::type>(t)).any()) {
+			return true;
+		}
+	}
+	//// then the valid swaps which are updated only around changed cells
+	update_moves();
+	return m_moves->any();
+}
+
+size_t game_controller::get_available_moves_count()
+{
+	update_moves();
+	return m_moves->count();
+}
+
+void game_controller::get_available_moves(board::moves& moves)
+{
+	update_moves();
+	m_moves->enumerate(moves);
+}
+
+void game_controller::evaluate_moves(move_evaluator::results& r)
+{
+	assert(m_board);
+	assert(m_matcher);
+	if (get_rows() > move_evaluator::max_size() || get_cols() > move_evaluator::max_size()) {
+		throw board_size_error(board::min_size(), move_evaluator::max_size());
+	}
+	//// the threads are created on the first call, the GUI may never need them
+	if (!m_evaluator) {
+		m_evaluator = move_evaluator::ptr(new move_evaluator(*m_matcher));
+	}
+	board::moves moves;
+	get_available_moves(moves);
+	m_evaluator->evaluate(*m_board, moves, r);
+}
+
+bool game_controller::get_booster_impact(const board_index& i, bitboard& impact_areas) const
+{
+	assert(m_board);
+	if (!m_board->contains(i) || !m_board->get_cell(i).is_booster()) {
+		return false;
+	}
+	impact_areas = bitboard(m_board->rows(), m_board->columns());
+	m_board->get_chain_mask(i, impact_areas);
+	return true;
+}
+
+const game_controller::cascade_steps& game_controller::get_last_cascade() const noexcept
+{
+	return m_cascade;
+}
+
+void game_controller::update_moves()
+{
+	assert(m_board);
+	assert(m_moves);
+	assert(m_matcher);
+	m_moves->update(*m_board, *m_matcher, m_board->get_changed_mask());
+	m_board->clear_changed_mask();
+}
@@ -1,149 +1,227 @@
-
-#ifndef GAME_CONTROLLER_HPP
-#define GAME_CONTROLLER_HPP
-
-#include "board.hpp"
-#include "boosters.hpp"
-#include "config.hpp"
-#include "figure.hpp"
-#include "index.hpp"
-#include "listener.hpp"
-#include "matcher.hpp"
-#include "objectives.hpp"
-#include "patterns.hpp"
-
-#include <map>
-#include <memory>
-
-
-//// @class game_controller
-//// @brief Singleton class to control the game: turns, status and etc...
-//// Game configuration should be loaded from given config JSON file
-//// The default config file: CONFIG.JSON
-class game_controller : public listener
-{
-public:
-    //// @enum gmae_status
-    //// @brief Game status enumeration
-    enum class game_status
-    {
-        not_started = 0,
-        in_progress,
-        passed,
-        failed
-    };
-
-public:
-	//// @brief Creates the game_controller
-	static void create();
-
-	//// @brief Destroys the game_controller example
-	static void destroy();
-
-    //// @brief Gets the game_controller example
-    static game_controller* get();
-
-private:
-	static game_controller* s_game_controller;
-
-public:
-    //// @brief Constructor
-    game_controller();
-
-    //// @brief Destructor
-    ~game_controller();
-
-public:
-    //// @brief Starts the game
-    void start_game();
-
-	//// @brief Gets the game status
-	game_status get_game_status() const noexcept;
-
-	//// @brief Gets the moves count
-	size_t get_moves_count() const noexcept;
-
-    //// @brief Gets the board rows count
-    size_t get_rows() const noexcept;
-
-    //// @brief Gets the board columns count
-    size_t get_cols() const noexcept;
-
-	//// @brief Gets the board item with given index
-	board_item* get_board_item(const index& i) const noexcept;
-
-	//// @brief Gets the objectives data
-	void get_objectives(std::vector<objective*>&) const noexcept;
-
-	//// @brief Process selection when user selects an item from board
-	//// It should try to swap items or just keeps the selected item
-	//// After swapping items controlle will try to find matchings, create or activate boosters
-	//// Some objects will be destroyed after successfull match
-	//// After successfull matching moves count will be decreased
-	void process_selection(const index&);
-
-	//// @brief Updates the current status
-	//// @note Game status will 'passed' if all objectives will be completed
-	////       Game status will 'failed' if moves count will be 0 but objectives won't be completed
-	void update_game_status(const game_status) noexcept;
-
-    //// @brief Determines whether if two specified indexes can be swapped or not
-    //// @return true if indexes can be swapped and false otherwise
-    //// @note You can swap indexes if they are neighbours (horizontal or vertical)
-    bool can_swap(const index&, const index&) const noexcept;
-
-    //// @brief Swaps given two indexes in board
-    void swap(const index&, const index&);
-	
-	//// @brief Checks if moves available in board or not
-	//// E.g Can swapped items match to patterns or not
-	//// If there are no available moves need to shuffle
-	bool moves_available();
-
-	//// @brief Shuffle board items
-	void shuffle();
-
-public:
-	void on_objectives_completed() noexcept override;
-
-private:
-    void init();
-    void init_patterns();
-    void load_config();
-    void fill_board();
-	void drop_columns(const std::set<int>&);
-	void drop_new_items();
-    void init_booster_types();
-    booster* create_booster(const booster::type&) noexcept;
-
-	bool match(const index&, match_data&);
-	bool proxy_match(const index&, const index&) const;
-
-	void activate_booster(booster*, const index&);
-
-	void process_matching(const index&, const match_data&);
-
-	void find_matchings_and_destroy();
-
-	/// @brief Decreases moves count
-	/// Notifies about failing level if moves count is 0 and objectives aren't completed
-	void decrease_moves_count();
-
-
-
-private:
-    config::ptr m_config = nullptr;
-    objectives::ptr m_objectives = nullptr;
-    matcher::ptr m_matcher = nullptr;
-    board::ptr m_board = nullptr;
-    game_status m_game_status = game_status::not_started;
-    size_t m_moves_count = 0;
-    size_t m_figure_colors_count = 0;
-	index m_selected_index = invalid_index;
-    figure::colors_t m_color_types;
-    std::map<pattern::type, booster::type> m_booster_types;
-
-};
-
-
-#endif /// GAME_CONTROLLER_HPP
+
+#ifndef GAME_CONTROLLER_HPP
+#define GAME_CONTROLLER_HPP
+
+#include "bitboard.hpp"
+#include "board.hpp"
+#include "board_index.hpp"
+#include "boosters.hpp"
+#include "cell.hpp"
+#include "config.hpp"
+#include "figure.hpp"
+#include "listener.hpp"
+#include "matcher.hpp"
+#include "move_evaluator.hpp"
+#include "move_set.hpp"
+#include "objectives.hpp"
+#include "patterns.hpp"
+#include "rng.hpp"
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+
+//// @class game_controller
+//// @brief Singleton class to control the game: turns, status and etc...
+//// Game configuration should be loaded from given config JSON file
+//// The default config file: CONFIG.JSON (see DEFAULT_CONFIG_FILE)
+class game_controller : public listener
+{
+public:
+    //// @enum gmae_status
+    //// @brief Game status enumeration
+    enum class game_status
+    {
+        not_started = 0,
+        in_progress,
+        passed,
+        failed
+    };
+
+	//// @struct cascade_step
+	//// @brief The record of one cascade iteration (see process_selection())
+	//// Every iteration runs fixed stages over the whole board: detect matches on the settled board,
+	//// resolve them, clear cells, place boosters, apply gravity to all columns and refill empty cells.
+	struct cascade_step
+	{
+		//// The count of detected matches (0 for the booster activation step)
+		size_t matches_count = 0;
+		//// The cleared cells in row-major order
+		std::vector<board_index> cleared;
+		//// The created boosters: the index and the type
+		std::vector<std::pair<board_index, booster::type>> boosters;
+		//// The moves of gravity stage
+		board::moves drops;
+		//// The new items of refill stage
+		std::list<std::pair<figure*, board_index>> new_items;
+	};
+
+	using cascade_steps = std::vector<cascade_step>;
+
+public:
+	//// @brief The config file which is used by GUI
+	static const std::string DEFAULT_CONFIG_FILE;
+
+public:
+	//// @brief Creates the game_controller
+	//// @param[in] f The config file
+	//// @throw see exceptions.hpp
+	static void create(const std::string& f = DEFAULT_CONFIG_FILE);
+
+	//// @brief Destroys the game_controller example
+	static void destroy();
+
+    //// @brief Gets the game_controller example
+    static game_controller* get();
+
+private:
+	static game_controller* s_game_controller;
+
+public:
+    //// @brief Constructor
+    //// @param[in] f The config file
+    explicit game_controller(const std::string& f = DEFAULT_CONFIG_FILE);
+
+    //// @brief Destructor
+    ~game_controller();
+
+public:
+    //// @brief Starts the game
+    //// @note The seed of config is used if it is specified, otherwise the game is different every run
+    void start_game();
+
+    //// @brief Starts the game with given seed
+    //// @note Same seed and same moves always reproduce the same game
+    //// @note The game can be restarted, the config and patterns are kept, the board, moves and objectives are reset
+    void start_game(uint64_t seed);
+
+    //// @brief Gets the seed of the game
+    uint64_t get_seed() const noexcept;
+
+	//// @brief Gets the game status
+	game_status get_game_status() const noexcept;
+
+	//// @brief Gets the moves count
+	size_t get_moves_count() const noexcept;
+
+    //// @brief Gets the board rows count
+    size_t get_rows() const noexcept;
+
+    //// @brief Gets the board columns count
+    size_t get_cols() const noexcept;
+
+	//// @brief Gets the board item with given index
+	board_item* get_board_item(const board_index& i) const noexcept;
+
+	//// @brief Gets the objectives data
+	void get_objectives(std::vector<objective*>&) const noexcept;
+
+	//// @brief Process selection when user selects an item from board
+	//// It should try to swap items or just keeps the selected item
+	//// After swapping items controlle will try to find matchings, create or activate boosters
+	//// Some objects will be destroyed after successfull match
+	//// After successfull matching moves count will be decreased
+	void process_selection(const board_index&);
+
+	//// @brief Updates the current status
+	//// @note Game status will 'passed' if all objectives will be completed
+	////       Game status will 'failed' if moves count will be 0 but objectives won't be completed
+	void update_game_status(const game_status) noexcept;
+
+    //// @brief Determines whether if two specified indexes can be swapped or not
+    //// @return true if indexes can be swapped and false otherwise
+    //// @note You can swap indexes if they are neighbours (horizontal or vertical)
+    bool can_swap(const board_index&, const board_index&) const noexcept;
+
+    //// @brief Swaps given two indexes in board
+    void swap(const board_index&, const board_index&);
+	
+	//// @brief Checks if moves available in board or not
+	//// E.g Can swapped items match to patterns or not
+	//// If there are no available moves need to shuffle
+	bool moves_available();
+
+	//// @brief Gets the count of valid swaps
+	//// @note Valid swaps are kept up to date incrementally (see move_set)
+	size_t get_available_moves_count();
+
+	//// @brief Gets the valid swaps (e.g. for hints or bots)
+	void get_available_moves(board::moves&);
+
+	//// @brief Simulates all valid swaps in parallel and gets their outcome (e.g. for hints or bots)
+	//// @note The results are in the order of get_available_moves()
+	//// @throw board_size_error if the board is larger than move_evaluator::max_size()
+	void evaluate_moves(move_evaluator::results&);
+
+	//// @brief Gets the cells which would be destroyed by activating the booster with given index (e.g. for hints or bots)
+	//// @note The board isn't modified (see board::get_chain_mask())
+	//// @return false if there is no booster with given index
+	bool get_booster_impact(const board_index&, bitboard&) const;
+
+	//// @brief Gets the cascade steps of the last move
+	const cascade_steps& get_last_cascade() const noexcept;
+
+	//// @brief Shuffle board items
+	//// @note Board is shuffled until there are valid moves, the matches of shuffled board are cascaded
+	void shuffle();
+
+public:
+	void on_objectives_completed() noexcept override;
+
+private:
+    void init(const std::string&);
+    void reset_game();
+    void init_patterns();
+    void load_config(const std::string&);
+    void fill_board();
+    cell create_figure(const game_rng::stream&) noexcept;
+	void update_moves();
+    cell create_booster(const booster::type&) noexcept;
+	void destroy_item(const board_index&);
+
+	bool match(const board_index&, match_data&);
+
+	void activate_booster(const board_index&);
+
+	//// @brief Runs cascade iterations until the settled board has no matches
+	//// @param[in] m The matches of the first iteration, the board is scanned if it is empty
+	void run_cascade(matcher::matches& m);
+
+	//// @brief The stages of cascade iteration, every stage is a bulk operation over the whole board
+	void clear_stage(cascade_step&);
+	void boosters_stage(cascade_step&);
+	void gravity_stage(cascade_step&);
+	void refill_stage(cascade_step&);
+
+	/// @brief Shuffles the board if there are no valid moves
+	void ensure_moves();
+
+	/// @brief Decreases moves count
+	/// Notifies about failing level if moves count is 0 and objectives aren't completed
+	void decrease_moves_count();
+
+
+
+private:
+    config::ptr m_config = nullptr;
+    objectives::ptr m_objectives = nullptr;
+    matcher::ptr m_matcher = nullptr;
+    board::ptr m_board = nullptr;
+    game_rng::ptr m_rng = nullptr;
+    move_set::ptr m_moves = nullptr;
+    move_evaluator::ptr m_evaluator = nullptr;
+    cascade_steps m_cascade;
+    game_status m_game_status = game_status::not_started;
+    size_t m_moves_count = 0;
+    size_t m_figure_colors_count = 0;
+	board_index m_selected_index = invalid_index;
+    figure::colors_t m_color_types;
+
+};
+
+
+#endif /// GAME_CONTROLLER_HPP
@@ -0,0 +1,284 @@
+
+#include "cell.hpp"
+#include "line_kernel.hpp"
+
+#include <cassert>
+#include <vector>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define LINE_KERNEL_X86
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#include <immintrin.h>
+#endif
+
+
+namespace {
+
+//// Lines are padded with empty cells: two lines before and after, two cells before and (vector width + 3) after each line
+constexpr size_t lines_padding = 2;
+constexpr size_t front_padding = 2;
+constexpr size_t back_padding = 32 + 3;
+constexpr size_t max_line_size = 256;
+
+namespace scalar {
+
+struct ops
+{
+	using vec = uint8_t;
+	static constexpr size_t width = 1;
+
+	static vec load(const uint8_t* p) noexcept { return *p; }
+	static void store(uint8_t* p, vec v) noexcept { *p = v; }
+	static vec eq(vec a, vec b) noexcept { return a == b ? 0xff : 0x00; }
+	static vec and_(vec a, vec b) noexcept { return a & b; }
+	static vec or_(vec a, vec b) noexcept { return a | b; }
+	static vec is_figure(vec a) noexcept { return (a & cell::kind_mask) == cell::figure_tag ? 0xff : 0x00; }
+};
+
+#include "line_kernel.inl"
+
+}
+
+#if defined(LINE_KERNEL_X86)
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("sse2"))), apply_to = function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("sse2")
+#endif
+
+namespace sse2 {
+
+struct ops
+{
+	using vec = __m128i;
+	static constexpr size_t width = 16;
+
+	static vec load(const uint8_t* p) noexcept { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); }
+	static void store(uint8_t* p, vec v) noexcept { _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v); }
+	static vec eq(vec a, vec b) noexcept { return _mm_cmpeq_epi8(a, b); }
+	static vec and_(vec a, vec b) noexcept { return _mm_and_si128(a, b); }
+	static vec or_(vec a, vec b) noexcept { return _mm_or_si128(a, b); }
+	static vec is_figure(vec a) noexcept
+	{
+		const vec kind = _mm_and_si128(a, _mm_set1_epi8(static_cast<char>(cell::kind_mask)));
+		return _mm_cmpeq_epi8(kind, _mm_set1_epi8(static_cast<char>(cell::figure_tag)));
+	}
+};
+
+#include "line_kernel.inl"
+
+}
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("avx2"))), apply_to = function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("avx2")
+#endif
+
+namespace avx2 {
+
+struct ops
+{
+	using vec = __m256i;
+	static constexpr size_t width = 32;
+
+	static vec load(const uint8_t* p) noexcept { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+	static void store(uint8_t* p, vec v) noexcept { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v); }
+	static vec eq(vec a, vec b) noexcept { return _mm256_cmpeq_epi8(a, b); }
+	static vec and_(vec a, vec b) noexcept { return _mm256_and_si256(a, b); }
+	static vec or_(vec a, vec b) noexcept { return _mm256_or_si256(a, b); }
+	static vec is_figure(vec a) noexcept
+	{
+		const vec kind = _mm256_and_si256(a, _mm256_set1_epi8(static_cast<char>(cell::kind_mask)));
+		return _mm256_cmpeq_epi8(kind, _mm256_set1_epi8(static_cast<char>(cell::figure_tag)));
+	}
+};
+
+#include "line_kernel.inl"
+
+}
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+bool cpu_has_sse2() noexcept
+{
+#if defined(_MSC_VER)
+	int info[4];
+	__cpuid(info, 1);
+	return (info[3] & (1 << 26)) != 0;
+#else
+	return __builtin_cpu_supports("sse2") != 0;
+#endif
+}
+
+bool cpu_has_avx2() noexcept
+{
+#if defined(_MSC_VER)
+	int info[4];
+	__cpuid(info, 0);
+	if (info[0] < 7) {
+		return false;
+	}
+	__cpuid(info, 1);
+	//// OS should save YMM registers
+	const bool os_saves_ymm = (info[2] & (1 << 27)) != 0 && (info[2] & (1 << 28)) != 0 && (_xgetbv(0) & 0x6) == 0x6;
+	if (!os_saves_ymm) {
+		return false;
+	}
+	__cpuidex(info, 7, 0);
+	return (info[1] & (1 << 5)) != 0;
+#else
+	return __builtin_cpu_supports("avx2") != 0;
+#endif
+}
+
+#else
+
+bool cpu_has_sse2() noexcept
+{
+	return false;
+}
+
+bool cpu_has_avx2() noexcept
+{
+	return false;
+}
+
+#endif // LINE_KERNEL_X86
+
+using kernel = void (*)(const uint8_t*, size_t, size_t, size_t, uint8_t*);
+
+bool is_supported(const line_kernel::backend& b) noexcept
+{
+	switch (b) {
+		case line_kernel::backend::scalar:
+			return true;
+		case line_kernel::backend::sse2:
+			return cpu_has_sse2();
+		case line_kernel::backend::avx2:
+			return cpu_has_avx2();
+	}
+	return false;
+}
+
+line_kernel::backend& current_backend() noexcept
+{
+	static line_kernel::backend b = is_supported(line_kernel::backend::avx2) ? line_kernel::backend::avx2
+		: is_supported(line_kernel::backend::sse2) ? line_kernel::backend::sse2
+		: line_kernel::backend::scalar;
+	return b;
+}
+
+kernel get_runs_kernel() noexcept
+{
+	switch (current_backend()) {
+#if defined(LINE_KERNEL_X86)
+		case line_kernel::backend::avx2:
+			return avx2::find_runs;
+		case line_kernel::backend::sse2:
+			return sse2::find_runs;
+#endif
+		default:
+			return scalar::find_runs;
+	}
+}
+
+kernel get_swaps_kernel() noexcept
+{
+	switch (current_backend()) {
+#if defined(LINE_KERNEL_X86)
+		case line_kernel::backend::avx2:
+			return avx2::find_swaps;
+		case line_kernel::backend::sse2:
+			return sse2::find_swaps;
+#endif
+		default:
+			return scalar::find_swaps;
+	}
+}
+
+//// Runs the kernel on zero padded copy of cells (transposed for vertical lines) and copies the result back
+void run_kernel(kernel k, const uint8_t* cells, size_t rows, size_t cols, bool vertical, uint8_t* out)
+{
+	assert(cells != nullptr);
+	assert(out != nullptr);
+	const size_t lines = vertical ? cols : rows;
+	const size_t length = vertical ? rows : cols;
+	assert(length <= max_line_size);
+	const size_t stride = front_padding + length + back_padding;
+	const size_t size = (lines + 2 * lines_padding) * stride;
+	//// buffers are kept per thread to avoid allocations on each call
+	thread_local std::vector<uint8_t> grid;
+	thread_local std::vector<uint8_t> result;
+	grid.assign(size, 0);
+	result.assign(size, 0);
+	const size_t first = lines_padding * stride + front_padding;
+	for (size_t r = 0; r < rows; ++r) {
+		for (size_t c = 0; c < cols; ++c) {
+			const size_t pos = vertical ? c * stride + r : r * stride + c;
+			grid[first + pos] = cells[r * cols + c];
+		}
+	}
+	k(grid.data() + first, lines, length, stride, result.data() + first);
+	for (size_t r = 0; r < rows; ++r) {
+		for (size_t c = 0; c < cols; ++c) {
+			const size_t pos = vertical ? c * stride + r : r * stride + c;
+			out[r * cols + c] = result[first + pos] != 0 ? 1 : 0;
+		}
+	}
+}
+
+}
+
+
+line_kernel::backend line_kernel::get_backend() noexcept
+{
+	return current_backend();
+}
+
+bool line_kernel::set_backend(const backend& b) noexcept
+{
+	if (!is_supported(b)) {
+		return false;
+	}
+	current_backend() = b;
+	return true;
+}
+
+const char* line_kernel::get_backend_name(const backend& b) noexcept
+{
+	switch (b) {
+		case backend::scalar:
+			return "scalar";
+		case backend::sse2:
+			return "sse2";
+		case backend::avx2:
+			return "avx2";
+	}
+	return "";
+}
+
+void line_kernel::find_runs(const uint8_t* cells, size_t rows, size_t cols, bool vertical, uint8_t* out)
+{
+	run_kernel(get_runs_kernel(), cells, rows, cols, vertical, out);
+}
+
+void line_kernel::find_swaps(const uint8_t* cells, size_t rows, size_t cols, bool vertical, uint8_t* out)
+{
+	run_kernel(get_swaps_kernel(), cells, rows, cols, vertical, out);
+}
@@ -0,0 +1,52 @@
+#ifndef CORE_LINE_KERNEL_HPP
+#define CORE_LINE_KERNEL_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+
+//// @class line_kernel
+//// @brief Vectorized checks over board lines (rows or columns) of one byte cells
+//// The cells of a line are compared with the same line (and the neighbour lines) shifted by one and two cells,
+//// so many cells are checked with one instruction. Columns are checked on a transposed copy of the cells.
+//// The kernels are compiled for SSE2 and AVX2, the best one supported by CPU is chosen at runtime.
+//// Scalar version is used if there are no supported instruction sets (e.g. non x86 CPU).
+//// The kernels decide if a settled board has matches (see board::get_matches_mask())
+//// and which swaps of changed rows are valid moves (see move_set).
+//// @note The cells are raw cell values (see cell::raw()), only figures make runs
+class line_kernel
+{
+public:
+	enum class backend {
+		scalar = 0,
+		sse2,
+		avx2
+	};
+
+public:
+	//// @brief Gets the currently used backend
+	static backend get_backend() noexcept;
+
+	//// @brief Sets the backend to use
+	//// @return false if CPU doesn't support the backend, the current backend is kept in that case
+	//// @note Used for testing and benchmarks. Don't call it while kernels are running in other threads
+	static bool set_backend(const backend&) noexcept;
+
+	//// @brief Gets the name of given backend
+	static const char* get_backend_name(const backend&) noexcept;
+
+	//// @brief Finds the cells covered by runs of at least 3 same figures
+	//// @param[in] cells The rows * cols cells in row-major order
+	//// @param[in] vertical Runs are searched in columns if true, in rows otherwise
+	//// @param[out] out The rows * cols values in row-major order: 1 if the cell is covered by a run, 0 otherwise
+	static void find_runs(const uint8_t* cells, size_t rows, size_t cols, bool vertical, uint8_t* out);
+
+	//// @brief Finds the swaps which make a match (a run of 3 same figures or a 2x2 square)
+	//// @param[in] cells The rows * cols cells in row-major order
+	//// @param[in] vertical The cells are swapped with bottom neighbour if true, with right neighbour otherwise
+	//// @param[out] out The rows * cols values in row-major order: 1 if the swap of the cell makes a match, 0 otherwise
+	//// @note The result is same as matcher::swap_match() with built-in patterns
+	static void find_swaps(const uint8_t* cells, size_t rows, size_t cols, bool vertical, uint8_t* out);
+};
+
+#endif // CORE_LINE_KERNEL_HPP
@@ -0,0 +1,91 @@
+//// Line kernel bodies
+//// This file is included by line_kernel.cpp once per instruction set inside of a namespace which defines `ops`:
+//// the vector type (vec), its width in cells and load, store, eq, and_, or_, is_figure functions.
+//// Lines are zero padded, so the kernels can read two cells before and (width + 3) cells after each cell.
+//// Zero is an empty cell, it is never equal to a figure.
+
+
+//// Marks the cells which are covered by runs of at least 3 same figures
+//// Run starts are found first (the cell is equal to next two cells), then they are spread to the next two cells
+void find_runs(const uint8_t* first_line, size_t lines, size_t length, size_t stride, uint8_t* first_out)
+{
+	assert(length <= max_line_size);
+	uint8_t starts[max_line_size + 64] = {};
+	uint8_t* s = starts + 2;
+	for (size_t l = 0; l < lines; ++l) {
+		const uint8_t* p = first_line + l * stride;
+		uint8_t* o = first_out + l * stride;
+		for (size_t i = 0; i < length; i += ops::width) {
+			const ops::vec a = ops::load(p + i);
+			const ops::vec run = ops::and_(ops::eq(a, ops::load(p + i + 1)), ops::eq(a, ops::load(p + i + 2)));
+			ops::store(s + i, ops::and_(ops::is_figure(a), run));
+		}
+		for (size_t i = 0; i < length; i += ops::width) {
+			const ops::vec covered = ops::or_(ops::load(s + i), ops::or_(ops::load(s + i - 1), ops::load(s + i - 2)));
+			ops::store(o + i, covered);
+		}
+	}
+}
+
+//// Marks the cells which make a match if they are swapped with the next cell of the line
+//// The cell c gets the color v (the next cell's value) and the next cell gets the color w (the cell's value).
+//// The swap makes a match if there is a run of 3 or a 2x2 square through any of them after swap.
+void find_swaps(const uint8_t* first_line, size_t lines, size_t length, size_t stride, uint8_t* first_out)
+{
+	for (size_t l = 0; l < lines; ++l) {
+		const uint8_t* p = first_line + l * stride;
+		const uint8_t* u1 = p - stride;
+		const uint8_t* u2 = p - 2 * stride;
+		const uint8_t* d1 = p + stride;
+		const uint8_t* d2 = p + 2 * stride;
+		uint8_t* o = first_out + l * stride;
+		for (size_t i = 0; i < length; i += ops::width) {
+			const ops::vec w = ops::load(p + i);
+			const ops::vec v = ops::load(p + i + 1);
+			const ops::vec vw = ops::eq(v, w);
+			//// the line around the swapped cells
+			const ops::vec m2 = ops::load(p + i - 2);
+			const ops::vec m1 = ops::load(p + i - 1);
+			const ops::vec p2 = ops::load(p + i + 2);
+			const ops::vec p3 = ops::load(p + i + 3);
+			//// the neighbour lines of the cell (c) and the next cell (n)
+			const ops::vec u2c = ops::load(u2 + i);
+			const ops::vec u1c = ops::load(u1 + i);
+			const ops::vec d1c = ops::load(d1 + i);
+			const ops::vec d2c = ops::load(d2 + i);
+			const ops::vec u2n = ops::load(u2 + i + 1);
+			const ops::vec u1n = ops::load(u1 + i + 1);
+			const ops::vec d1n = ops::load(d1 + i + 1);
+			const ops::vec d2n = ops::load(d2 + i + 1);
+			//// the neighbour lines of the previous cell and the cell after next
+			const ops::vec u1m = ops::load(u1 + i - 1);
+			const ops::vec d1m = ops::load(d1 + i - 1);
+			const ops::vec u1p = ops::load(u1 + i + 2);
+			const ops::vec d1p = ops::load(d1 + i + 2);
+
+			//// v on the cell's place
+			const ops::vec m1v = ops::eq(m1, v);
+			const ops::vec u1cv = ops::eq(u1c, v);
+			const ops::vec d1cv = ops::eq(d1c, v);
+			const ops::vec line_v = ops::or_(ops::and_(ops::eq(m2, v), m1v), ops::and_(vw, ops::or_(m1v, ops::eq(p2, v))));
+			const ops::vec cross_v = ops::or_(ops::and_(ops::eq(u2c, v), u1cv), ops::or_(ops::and_(u1cv, d1cv), ops::and_(d1cv, ops::eq(d2c, v))));
+			const ops::vec square_v = ops::or_(
+				ops::and_(m1v, ops::or_(ops::and_(ops::eq(u1m, v), u1cv), ops::and_(ops::eq(d1m, v), d1cv))),
+				ops::and_(vw, ops::or_(ops::and_(u1cv, ops::eq(u1n, v)), ops::and_(d1cv, ops::eq(d1n, v)))));
+			const ops::vec match_v = ops::and_(ops::is_figure(v), ops::or_(line_v, ops::or_(cross_v, square_v)));
+
+			//// w on the next cell's place
+			const ops::vec p2w = ops::eq(p2, w);
+			const ops::vec u1nw = ops::eq(u1n, w);
+			const ops::vec d1nw = ops::eq(d1n, w);
+			const ops::vec line_w = ops::or_(ops::and_(p2w, ops::eq(p3, w)), ops::and_(vw, ops::or_(ops::eq(m1, w), p2w)));
+			const ops::vec cross_w = ops::or_(ops::and_(ops::eq(u2n, w), u1nw), ops::or_(ops::and_(u1nw, d1nw), ops::and_(d1nw, ops::eq(d2n, w))));
+			const ops::vec square_w = ops::or_(
+				ops::and_(p2w, ops::or_(ops::and_(ops::eq(u1p, w), u1nw), ops::and_(ops::eq(d1p, w), d1nw))),
+				ops::and_(vw, ops::or_(ops::and_(ops::eq(u1c, w), u1nw), ops::and_(ops::eq(d1c, w), d1nw))));
+			const ops::vec match_w = ops::and_(ops::is_figure(w), ops::or_(line_w, ops::or_(cross_w, square_w)));
+
+			ops::store(o + i, ops::or_(match_v, match_w));
+		}
+	}
+}
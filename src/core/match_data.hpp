@@ -1,48 +1,83 @@
-
-#ifndef MATCH_DATA_HPP
-#define MATCH_DATA_HPP
-
-#include "index.hpp"
-#include "patterns.hpp"
-
-#include <list>
-
-
-//// @class match_data
-//// @brief Data holder class for keeping matching information
-//// E.g The matched pattern type and matched indexes
-class match_data
-{
-public:
-	//// @brief Constructor
-    match_data() = default;
-
-	//// @brief Destructor
-    virtual ~match_data() = default;
-
-public:
-	//// @brief Gets the matched pattern type
-    pattern::type get_pattern_type() const noexcept;
-
-	//// @brief Gets the matched indexes
-    void get_indexes(std::list<index>&) const noexcept;
-
-	//// @brief Gets the matched pattern type
-    void set_pattern_type(const pattern::type&) noexcept;
-
-	//// @brief Sets the matched indexes
-    void set_indexes(const std::list<index>&) noexcept;
-
-	//// @brief Resest the match data
-	void reset() noexcept;
-
-private:
-    std::list<index> m_indexes;
-    pattern::type m_pattern_type;
-
-};
-
-
-#endif // MATCH_DATA_HPP
-
-
+
+#ifndef MATCH_DATA_HPP
+#define MATCH_DATA_HPP
+
+#include "board_index.hpp"
+#include "boosters.hpp"
+#include "patterns.hpp"
+#include "span.hpp"
+
+#include <cstddef>
+#include <type_traits>
+
+
+//// @class match_data
+//// @brief Data holder class for keeping matching information
+//// E.g The matched pattern type, matched indexes and the booster which should be created for the match
+//// @note Indexes are kept inline, so matching doesn't allocate
+class match_data
+{
+public:
+	//// @brief The maximum count of matched indexes - 255
+	//// Runs aren't longer than board's rows or columns count and shapes have up to 25 cells
+	static constexpr size_t max_indexes_count = board_index::max_coordinate + 1;
+
+public:
+	//// @brief Constructor
+    match_data() = default;
+
+	//// @brief Copy Constructor
+	//// @note Only matched indexes are copied
+	match_data(const match_data&) noexcept;
+
+	//// @brief Copy Assignment
+	match_data& operator= (const match_data&) noexcept;
+
+	//// @brief Destructor
+    virtual ~match_data() = default;
+
+public:
+	//// @brief Gets the matched pattern type
+    pattern::type get_pattern_type() const noexcept;
+
+	//// @brief Gets the matched indexes
+	//// @note The view is valid until match data is changed or destroyed
+    span<const board_index> get_indexes() const noexcept;
+
+	//// @brief Gets the matched pattern type
+    void set_pattern_type(const pattern::type&) noexcept;
+
+	//// @brief Adds a matched index
+	//// @note Count of indexes should be less than max_indexes_count
+    void add_index(const board_index&) noexcept;
+
+	//// @brief Checks if a booster should be created for the match
+	bool has_booster() const noexcept;
+
+	//// @brief Gets the type of booster which should be created for the match
+	//// @note The match should have a booster
+	booster::type get_booster_type() const noexcept;
+
+	//// @brief Sets the type of booster which should be created for the match
+	void set_booster_type(const booster::type&) noexcept;
+
+	//// @brief Resest the match data
+	void reset() noexcept;
+
+private:
+	//// index has no default constructor, so the indexes are kept in raw storage
+	using storage_t = std::aligned_storage<sizeof(board_index), alignof(board_index)>::type;
+
+private:
+    storage_t m_indexes[max_indexes_count];
+    size_t m_indexes_count = 0;
+    pattern::type m_pattern_type = pattern::type::UNDEFINED;
+    bool m_has_booster = false;
+    booster::type m_booster_type = booster::type::radial;
+
+};
+
+
+#endif // MATCH_DATA_HPP
+
+
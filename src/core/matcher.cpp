@@ -1,61 +1,247 @@
-
-#include "matcher.hpp"
-#include "match_data.hpp"
-#include "patterns.hpp"
-#include "proxy_figure.hpp"
-
-
-#include <cassert>
-#include <iostream>
-
-
-
-bool matcher::match(const board::ptr& b, const index& i, match_data& m)
-{
-    m.reset();
-    for (auto it : m_patterns) {
-        if (it->match(b, i, m)) {
-            return true;
-        }
-    }
-    return false;
-}
-
-bool matcher::proxy_match(const board::ptr& b, const index& pi1, const index& pi2)
-{
-	std::unique_ptr<proxy_figure> pf1;
-	std::unique_ptr<proxy_figure> pf2;
-	board_item* item = b->get_item(pi1);
-	if (item != nullptr && item->is_figure()) {
-		pf1.reset(new proxy_figure(static_cast<figure*>(item)->get_color(), pi2));
-		b->add_proxy_figure(pf1.get());
-	}
-	item = b->get_item(pi2);
-	if (item != nullptr && item->is_figure()) {
-		pf2.reset(new proxy_figure(static_cast<figure*>(item)->get_color(), pi1));
-		b->add_proxy_figure(pf2.get());
-	}
-
-	bool matched = false;
-	for (auto it : m_patterns) {
-		match_data md;
-		if (it->match(b, pi1, md)) {
-			matched = true;
-			break;
-		}
-		if (it->match(b, pi2, md)) {
-			matched = true;
-			break;
-		}
-	}
-
-	b->remove_proxy_figure(pf1.get());
-	b->remove_proxy_figure(pf2.get());
-	return matched;
-}
-
-void matcher::add_pattern(pattern* p)
-{
-    assert(p != nullptr);
-    m_patterns.push_back(p);
-}
+
+#include "matcher.hpp"
+#include "match_data.hpp"
+#include "patterns.hpp"
+#include "swap_view.hpp"
+
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+
+
+
+bool matcher::match(const board::ptr& b, const board_index& i, match_data& m) const
+{
+    assert(b);
+    m.reset();
+    const swap_view v(*b);
+    return match(v, i, m);
+}
+
+bool matcher::match(const swap_view& v, const board_index& i, match_data& m) const
+{
+	if (m_table) {
+		const placement* p = lookup(v, i);
+		if (p == nullptr) {
+			return false;
+		}
+		m_patterns[p->pattern]->set_match(v, i, p->number, m);
+		return true;
+	}
+    for (const auto& it : m_patterns) {
+        if (it->match(v, i, m)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool matcher::swap_match(const board::ptr& b, const board_index& i1, const board_index& i2) const
+{
+	assert(b);
+	return swap_match(*b, i1, i2);
+}
+
+bool matcher::swap_match(const board& b, const board_index& i1, const board_index& i2) const
+{
+	const swap_view v(b, i1, i2);
+	if (m_table) {
+		return lookup(v, i1) != nullptr || lookup(v, i2) != nullptr;
+	}
+	for (const auto& it : m_patterns) {
+		match_data md;
+		if (it->match(v, i1, md)) {
+			return true;
+		}
+		if (it->match(v, i2, md)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+void matcher::find_all(const board::ptr& b, matches& result) const
+{
+	assert(b);
+	result.clear();
+	if (!may_have_matches(*b)) {
+		return;
+	}
+	for (const auto& it : m_patterns) {
+		bitboard claimed(b->rows(), b->columns());
+		it->scan(*b, claimed, result);
+	}
+}
+
+void matcher::resolve(const board::ptr& b, const matches& m, resolution& result) const
+{
+	assert(b);
+	result.cleared.clear();
+	result.boosters.clear();
+	//// the cells of matches and the group of overlapping matches which the match belongs to
+	std::vector<bitboard> masks(m.size(), bitboard(b->rows(), b->columns()));
+	std::vector<size_t> groups(m.size());
+	for (size_t k = 0; k < m.size(); ++k) {
+		for (const auto& i : m[k].second.get_indexes()) {
+			masks[k].set(i);
+		}
+		groups[k] = k;
+		for (size_t j = 0; j < k; ++j) {
+			if ((masks[k] & masks[j]).none() || groups[j] == groups[k]) {
+				continue;
+			}
+			//// the match joins the group of previous match, the groups are merged to the earlier one
+			const size_t from = std::max(groups[j], groups[k]);
+			const size_t to = std::min(groups[j], groups[k]);
+			for (size_t g = 0; g <= k; ++g) {
+				if (groups[g] == from) {
+					groups[g] = to;
+				}
+			}
+		}
+	}
+	//// matches are in priority order, so the first match with booster decides the group's booster
+	bitboard cleared(b->rows(), b->columns());
+	std::vector<bool> has_booster(m.size(), false);
+	for (size_t k = 0; k < m.size(); ++k) {
+		cleared |= masks[k];
+		const match_data& md = m[k].second;
+		if (md.has_booster() && !has_booster[groups[k]]) {
+			has_booster[groups[k]] = true;
+			result.boosters.push_back(std::make_pair(m[k].first, md.get_booster_type()));
+		}
+	}
+	cleared.for_each([&result](const board_index& i) {
+		result.cleared.push_back(i);
+	});
+}
+
+bool matcher::may_have_matches(const board& b) const
+{
+	if (!m_line_based) {
+		return true;
+	}
+	//// every pattern has a run of 3 or a square, so there are no matches if there are none
+	return b.get_matches_mask().any();
+}
+
+bool matcher::is_line_based() const noexcept
+{
+	return m_line_based;
+}
+
+void matcher::add_pattern(pattern::ptr p)
+{
+    assert(p != nullptr);
+    m_line_based = m_line_based && p->is_line_based();
+    m_patterns.push_back(std::move(p));
+    build_table();
+}
+
+size_t matcher::get_reach() const noexcept
+{
+	size_t reach = 0;
+	for (const auto& it : m_patterns) {
+		reach = std::max(reach, it->get_reach());
+	}
+	return reach;
+}
+
+void matcher::set_mode(const mode& m)
+{
+	m_mode = m;
+	build_table();
+}
+
+matcher::mode matcher::get_mode() const noexcept
+{
+	return m_table ? mode::lookup : mode::sequential;
+}
+
+void matcher::build_table()
+{
+	m_placements.clear();
+	if (m_mode != mode::lookup) {
+		m_table.reset();
+		return;
+	}
+	//// placements are kept in priority order, so the first matched one is the match
+	std::vector<uint32_t> masks;
+	for (size_t p = 0; p < m_patterns.size(); ++p) {
+		if (!m_patterns[p]->get_placements(masks)) {
+			m_placements.clear();
+			m_table.reset();
+			return;
+		}
+		for (size_t k = 0; k < masks.size(); ++k) {
+			m_placements.push_back(placement{ p, k, masks[k] });
+		}
+	}
+	if (m_placements.size() > std::numeric_limits<uint8_t>::max() - unmatched) {
+		m_placements.clear();
+		m_table.reset();
+		return;
+	}
+	//// the entries depend on the placements, so they are resolved again
+	const size_t size = size_t(1) << neighbourhood::bits_count;
+	if (!m_table) {
+		m_table.reset(new std::atomic<uint8_t>[size]());
+	} else {
+		std::fill(m_table.get(), m_table.get() + size, unresolved);
+	}
+}
+
+const matcher::placement* matcher::lookup(const swap_view& v, const board_index& i) const
+{
+	assert(m_table);
+	assert(v.contains(i));
+	const figure::color c = v.get_color(i);
+	if (c == figure::color::UNDEFINED) {
+		return nullptr;
+	}
+	const uint32_t n = get_neighbourhood(v, i, c);
+	uint8_t e = m_table[n].load(std::memory_order_relaxed);
+	if (e == unresolved) {
+		e = unmatched;
+		for (size_t k = 0; k < m_placements.size(); ++k) {
+			if ((n & m_placements[k].mask) == m_placements[k].mask) {
+				e = static_cast<uint8_t>(k + unmatched + 1);
+				break;
+			}
+		}
+		//// several threads can resolve the same entry, but they store the same value
+		m_table[n].store(e, std::memory_order_relaxed);
+	}
+	return e == unmatched ? nullptr : &m_placements[e - unmatched - 1];
+}
+
+uint32_t matcher::get_neighbourhood(const swap_view& v, const board_index& i, const figure::color& c) const
+{
+	const bitboard& m = v.get_board().get_color_mask(c);
+	const int r = static_cast<int>(i.row());
+	const int col = static_cast<int>(i.column());
+	uint32_t bits = 0;
+	for (int dr = -neighbourhood::radius; dr <= neighbourhood::radius; ++dr) {
+		const uint32_t row = m.get_row_bits(r + dr, col - neighbourhood::radius, neighbourhood::size);
+		bits |= row << ((dr + neighbourhood::radius) * neighbourhood::size);
+	}
+	//// drop the bit of the cell itself
+	const size_t center = neighbourhood::bits_count / 2;
+	bits = (bits & ((uint32_t(1) << center) - 1)) | ((bits >> (center + 1)) << center);
+	//// the color mask doesn't know about swapped cells
+	for (const board_index& s : { v.get_first(), v.get_second() }) {
+		if (!s.is_valid()) {
+			continue;
+		}
+		const uint32_t bit = neighbourhood::bit(static_cast<int>(s.row()) - r, static_cast<int>(s.column()) - col);
+		if (v.get_color(s) == c) {
+			bits |= bit;
+		} else {
+			bits &= ~bit;
+		}
+	}
+	return bits;
+}
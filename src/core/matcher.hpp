@@ -1,61 +1,145 @@
-
-#ifndef MATCHER_HPP
-#define MATCHER_HPP
-
-#include "board.hpp"
-#include "index.hpp"
-#include "patterns.hpp"
-#include "proxy_figure.hpp"
-
-#include <list>
-#include <memory>
-#include <vector>
-
-
-class match_data;
-
-
-//// @class matcher
-//// @brief This is pattern matcher
-//// Matcher will start find matched patterns by calling match() function (or proxy_match)
-//// The matched result will be hold in match_data structure
-class matcher
-{
-public:
-    using ptr = std::unique_ptr<matcher>;
-
-public:
-    struct data
-    {
-        pattern::type type;
-        std::list<index> indexes;
-    };
-
-public:
-	//// @brief Constructor
-    matcher() = default;
-
-	//// @brief Destructor
-    ~matcher() = default;
-
-public:
-	//// @brief Matches pattern combinations with priority
-	//// Collects the matched indexes, pattern type information
-    bool match(const board::ptr&, const index&, match_data&);
-
-	//// @brief Matches pattern combinations with (optimized) priority
-	//// @note proxy_match() creates proxy figures on board from specified indexes
-	//// @note This function won't collect match data
-	bool proxy_match(const board::ptr&, const index&, const index&);
-
-	//// @brief Add a new pattern
-	//// @note Pattern should be added by priority
-	//// E.g. First added pattern will be matched first then others
-    void add_pattern(pattern*);
-
-private:
-    std::vector<pattern*> m_patterns;
-    std::list<index> m_matched_indexes;
-};
-
-#endif // MATCHER_HPP
+
+#ifndef MATCHER_HPP
+#define MATCHER_HPP
+
+#include "board.hpp"
+#include "board_index.hpp"
+#include "match_data.hpp"
+#include "patterns.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <utility>
+#include <vector>
+
+
+//// @class matcher
+//// @brief This is pattern matcher
+//// Matcher will start find matched patterns by calling match() function (or swap_match)
+//// The matched result will be hold in match_data structure
+//// All matches of the board can be found at once by calling find_all() function
+//// @note In lookup mode match() doesn't check patterns one by one: the cell's neighbourhood mask is resolved
+//// with a table to the first matched placement of the patterns (see pattern::get_placements())
+//// @note The table has a one byte entry per neighbourhood mask, it is 2^24 bytes (16 MB) per matcher.
+//// It is allocated by set_mode() and is freed with the matcher or when sequential mode is set.
+class matcher
+{
+public:
+    using ptr = std::unique_ptr<matcher>;
+
+	//// @enum mode
+	//// @brief The mode of match() and swap_match()
+	enum class mode
+	{
+		sequential = 0,
+		lookup
+	};
+
+	//// The matches found by find_all(): the index where booster should be created and the match data
+	using matches = pattern::matches;
+
+	//// @struct resolution
+	//// @brief The result of resolving simultaneous matches (see resolve())
+	struct resolution
+	{
+		//// The cells which should be cleared in row-major order
+		std::vector<board_index> cleared;
+		//// The boosters which should be created after clearing: the index and the type
+		std::vector<std::pair<board_index, booster::type>> boosters;
+	};
+
+public:
+    struct data
+    {
+        pattern::type type;
+        std::list<board_index> indexes;
+    };
+
+public:
+	//// @brief Constructor
+    matcher() = default;
+
+	//// @brief Destructor
+    ~matcher() = default;
+
+public:
+	//// @brief Matches pattern combinations with priority
+	//// Collects the matched indexes, pattern type information
+    bool match(const board::ptr&, const board_index&, match_data&) const;
+
+	//// @brief Matches pattern combinations with priority as if specified indexes were swapped
+	//// @note The board is not changed (see swap_view), so it can be called for the same board from several threads
+	//// @note This function won't collect match data
+	bool swap_match(const board::ptr&, const board_index&, const board_index&) const;
+
+	//// @brief Matches pattern combinations with priority as if specified indexes were swapped
+	bool swap_match(const board&, const board_index&, const board_index&) const;
+
+	//// @brief Finds all matches of the board, the matches of different patterns can overlap
+	//// Every pattern scans the whole board at once (see pattern::scan())
+	//// Matches are in patterns priority order, so they can be resolved together (see resolve())
+	//// @note Matches of the same pattern don't overlap
+	void find_all(const board::ptr&, matches&) const;
+
+	//// @brief Resolves the matches which were found on the same board state
+	//// Overlapping matches are merged into groups: all cells of the group are cleared
+	//// and the group gets only one booster - the booster of its first match (in given order) which has it.
+	//// @param[in] b The board
+	//// @param[in] m The matches in priority order
+	//// @param[out] r The cells to clear and the boosters to create
+	void resolve(const board::ptr& b, const matches& m, resolution& r) const;
+
+	//// @brief Checks if every pattern has a run of 3 or a 2x2 square (see pattern::is_line_based())
+	//// If it is false, board masks aren't enough to find available moves
+	bool is_line_based() const noexcept;
+
+	//// @brief Add a new pattern
+	//// @note Pattern should be added by priority
+	//// E.g. First added pattern will be matched first then others
+	//// @note Matcher takes the ownership of pattern
+    void add_pattern(pattern::ptr);
+
+	//// @brief Gets the maximum reach of patterns (see pattern::get_reach())
+	//// A swap can make a match only if changed cells are in the reach of swapped cells
+	size_t get_reach() const noexcept;
+
+	//// @brief Sets the matching mode
+	//// @note Lookup mode is used only if every pattern fits in the neighbourhood (see neighbourhood)
+	//// @note Lookup mode allocates the table of 16 MB (see matcher)
+	void set_mode(const mode&);
+
+	//// @brief Gets the matching mode which is used
+	mode get_mode() const noexcept;
+
+private:
+	//// The placement of a pattern in the neighbourhood
+	struct placement
+	{
+		size_t pattern;
+		size_t number;
+		uint32_t mask;
+	};
+
+	//// The table entries: 0 - not resolved yet, 1 - no match, otherwise placement number + 2
+	using table = std::unique_ptr<std::atomic<uint8_t>[]>;
+	static constexpr uint8_t unresolved = 0;
+	static constexpr uint8_t unmatched = 1;
+
+	void build_table();
+	bool may_have_matches(const board&) const;
+	bool match(const swap_view&, const board_index&, match_data&) const;
+	const placement* lookup(const swap_view&, const board_index&) const;
+	uint32_t get_neighbourhood(const swap_view&, const board_index&, const figure::color&) const;
+
+private:
+    std::vector<pattern::ptr> m_patterns;
+    mode m_mode = mode::sequential;
+    std::vector<placement> m_placements;
+    //// an entry per neighbourhood mask, entries are resolved on first use
+    table m_table;
+    bool m_line_based = true;
+};
+
+#endif // MATCHER_HPP
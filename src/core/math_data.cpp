@@ -1,33 +1,72 @@
-
-#include "match_data.hpp"
-
-#include <cassert>
-
-
-pattern::type match_data::get_pattern_type() const noexcept
-{
-    assert(m_pattern_type != pattern::type::UNDEFINED);
-    return m_pattern_type;
-}
-
-void match_data::get_indexes(std::list<index>& indexes) const noexcept
-{
-    indexes = m_indexes;
-}
-
-void match_data::reset() noexcept
-{
-    m_indexes.clear();
-    m_pattern_type = pattern::type::UNDEFINED;
-}
-
-void match_data::set_pattern_type(const pattern::type& t) noexcept
-{
-    assert(t != pattern::type::UNDEFINED);
-    m_pattern_type = t;
-}
-
-void match_data::set_indexes(const std::list<index>& i) noexcept
-{
-    m_indexes = i;
-}
+
+#include "match_data.hpp"
+
+#include <cassert>
+#include <cstring>
+#include <new>
+
+
+match_data::match_data(const match_data& md) noexcept
+{
+    *this = md;
+}
+
+match_data& match_data::operator= (const match_data& md) noexcept
+{
+    if (this == &md) {
+        return *this;
+    }
+    std::memcpy(m_indexes, md.m_indexes, md.m_indexes_count * sizeof(storage_t));
+    m_indexes_count = md.m_indexes_count;
+    m_pattern_type = md.m_pattern_type;
+    m_has_booster = md.m_has_booster;
+    m_booster_type = md.m_booster_type;
+    return *this;
+}
+
+pattern::type match_data::get_pattern_type() const noexcept
+{
+    assert(m_pattern_type != pattern::type::UNDEFINED);
+    return m_pattern_type;
+}
+
+span<const board_index> match_data::get_indexes() const noexcept
+{
+    return span<const board_index>(reinterpret_cast<const board_index*>(m_indexes), m_indexes_count);
+}
+
+bool match_data::has_booster() const noexcept
+{
+    return m_has_booster;
+}
+
+booster::type match_data::get_booster_type() const noexcept
+{
+    assert(m_has_booster);
+    return m_booster_type;
+}
+
+void match_data::set_booster_type(const booster::type& t) noexcept
+{
+    m_has_booster = true;
+    m_booster_type = t;
+}
+
+void match_data::reset() noexcept
+{
+    m_indexes_count = 0;
+    m_pattern_type = pattern::type::UNDEFINED;
+    m_has_booster = false;
+}
+
+void match_data::set_pattern_type(const pattern::type& t) noexcept
+{
+    assert(t != pattern::type::UNDEFINED);
+    m_pattern_type = t;
+}
+
+void match_data::add_index(const board_index& i) noexcept
+{
+    assert(m_indexes_count < max_indexes_count);
+    new (&m_indexes[m_indexes_count++]) board_index(i);
+}
@@ -0,0 +1,134 @@
+
+#include "bitboard.hpp"
+#include "board_kernels.hpp"
+#include "boosters.hpp"
+#include "cell.hpp"
+#include "match_data.hpp"
+#include "move_evaluator.hpp"
+
+#include <cassert>
+
+
+size_t move_evaluator::max_size() noexcept
+{
+	return board_kernels::max_fixed_size;
+}
+
+move_evaluator::move_evaluator(const matcher& m, size_t threads)
+	: m_matcher(m)
+	, m_pool(threads)
+{
+}
+
+void move_evaluator::evaluate(const board& b, const board::moves& swaps, results& r)
+{
+	r.assign(swaps.size(), swap_result());
+	m_pool.run(swaps.size(), [this, &b, &swaps, &r](size_t k) {
+		evaluate(b, swaps[k].first, swaps[k].second, r[k]);
+	});
+}
+
+void move_evaluator::evaluate(const board& b, results& r)
+{
+	board::moves swaps;
+	const size_t rows = b.rows();
+	const size_t cols = b.columns();
+	for (size_t i = 0; i < rows; ++i) {
+		for (size_t j = 0; j < cols; ++j) {
+			if (j + 1 < cols) {
+				swaps.push_back(std::make_pair(board_index(i, j), board_index(i, j + 1)));
+			}
+			if (i + 1 < rows) {
+				swaps.push_back(std::make_pair(board_index(i, j), board_index(i + 1, j)));
+			}
+		}
+	}
+	evaluate(b, swaps, r);
+}
+
+void move_evaluator::evaluate(const board& b, const board_index& i1, const board_index& i2, swap_result& r) const
+{
+	r = swap_result();
+	r.first = i1;
+	r.second = i2;
+	if (!b.contains(i1) || !b.contains(i2) || !b.can_swap(i1, i2)) {
+		return;
+	}
+	const cell item1 = b.get_cell(i1);
+	const cell item2 = b.get_cell(i2);
+	//// the same rules as game_controller::process_selection()
+	if (item1.is_empty() || item2.is_empty() || (item1.is_booster() && item2.is_booster())) {
+		return;
+	}
+	if (!item1.is_booster() && !item2.is_booster() && !m_matcher.swap_match(b, i1, i2)) {
+		return;
+	}
+	r.valid = true;
+	board::ptr copy = b.clone();
+	copy->swap(i1, i2);
+	matcher::matches matches;
+	if (item1.is_booster() || item2.is_booster()) {
+		//// the booster is activated where it was moved to
+		activate(copy, item1.is_booster() ? i2 : i1, r);
+		//// the blast and the drop can make matches anywhere, so the whole board is scanned
+		m_matcher.find_all(copy, matches);
+	} else {
+		match_data md;
+		if (m_matcher.match(copy, i1, md)) {
+			matches.push_back(std::make_pair(i1, md));
+		}
+		md.reset();
+		if (m_matcher.match(copy, i2, md)) {
+			matches.push_back(std::make_pair(i2, md));
+		}
+	}
+	cascade(copy, matches, r);
+}
+
+void move_evaluator::activate(board::ptr& b, const board_index& i, swap_result& r) const
+{
+	//// the chain is resolved by the board, the same as game_controller::activate_booster()
+	bitboard impact_areas(b->rows(), b->columns());
+	b->get_chain_mask(i, impact_areas);
+	impact_areas.for_each([this, &b, &r](const board_index& it) {
+		destroy(b, it, r);
+	});
+	board::moves moves;
+	b->drop_items(moves);
+}
+
+void move_evaluator::cascade(board::ptr& b, matcher::matches& m, swap_result& r) const
+{
+	matcher::resolution res;
+	while (!m.empty()) {
+		++r.cascade_depth;
+		r.matches_count += m.size();
+		res.cleared.clear();
+		res.boosters.clear();
+		m_matcher.resolve(b, m, res);
+		for (const auto& it : res.cleared) {
+			destroy(b, it, r);
+		}
+		for (const auto& it : res.boosters) {
+			b->add_item(cell::from_booster(it.second), it.first);
+		}
+		r.boosters_created += res.boosters.size();
+		board::moves moves;
+		b->drop_items(moves);
+		m_matcher.find_all(b, m);
+	}
+}
+
+void move_evaluator::destroy(board::ptr& b, const board_index& i, swap_result& r) const
+{
+	const cell destroyed = b->destroy_item(i);
+	if (destroyed.is_empty()) {
+		return;
+	}
+	++r.destroyed_count;
+	if (destroyed.is_figure()) {
+		++r.destroyed_figures[static_cast<size_t>(destroyed.get_color())];
+	} else {
+		++r.boosters_activated;
+	}
+}
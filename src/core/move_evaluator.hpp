@@ -0,0 +1,99 @@
+#ifndef CORE_MOVE_EVALUATOR_HPP
+#define CORE_MOVE_EVALUATOR_HPP
+
+#include "board.hpp"
+#include "board_index.hpp"
+#include "figure.hpp"
+#include "matcher.hpp"
+#include "thread_pool.hpp"
+
+#include <array>
+#include <memory>
+#include <vector>
+
+
+//// @struct swap_result
+//// @brief The outcome of one swap which is simulated by move_evaluator
+struct swap_result
+{
+	//// The swapped indexes
+	board_index first = invalid_index;
+	board_index second = invalid_index;
+
+	//// Is the swap accepted by game rules (it makes a match or activates a booster)
+	bool valid = false;
+
+	//// The count of matches of all cascade steps
+	size_t matches_count = 0;
+
+	//// The count of destroyed items (figures and boosters)
+	size_t destroyed_count = 0;
+
+	//// The count of destroyed figures per color, this is the progress of objectives
+	std::array<size_t, figure::colors_count> destroyed_figures = {};
+
+	//// The count of created boosters
+	size_t boosters_created = 0;
+
+	//// The count of activated boosters (including chained ones)
+	size_t boosters_activated = 0;
+
+	//// The count of cascade steps (board scans which found matches, including the first one)
+	size_t cascade_depth = 0;
+};
+
+//// @class move_evaluator
+//// @brief Evaluates the candidate swaps of board in parallel
+//// Every swap is simulated on a private copy of the board, so the swaps are independent
+//// and are shared between the threads of the pool. The results are written to a flat array
+//// with the same order as the swaps, so they don't depend on the threads count.
+//// @note New items aren't dropped to the board, because they are random.
+////       The cascade stops when there are no matches without new items.
+//// @note Evaluator is meant for GUI-sized boards (see max_size()). Every swap copies the board
+////       and scans the whole of it on every cascade step, so one evaluation costs O(cells^2).
+class move_evaluator
+{
+public:
+    using ptr = std::unique_ptr<move_evaluator>;
+
+	using results = std::vector<swap_result>;
+
+public:
+	//// @brief Gets the maximal rows and columns count of board which evaluator is meant for
+	static size_t max_size() noexcept;
+
+public:
+	//// @brief Constructor
+	//// @param[in] m The matcher of the game, it should live longer than evaluator
+	//// @param[in] threads The count of threads (see thread_pool)
+	explicit move_evaluator(const matcher& m, size_t threads = 0);
+
+	//// @brief Destructor
+	~move_evaluator() = default;
+
+public:
+	//// @brief Evaluates given swaps
+	//// @param[in] b The board, it isn't modified
+	//// @param[in] swaps The swaps, the indexes should be neighbours
+	//// @param[out] r The results, one per swap
+	void evaluate(const board& b, const board::moves& swaps, results& r);
+
+	//// @brief Evaluates all swaps of neighbours
+	//// @note The swaps are in row-major order of the first index, a swap with right neighbour goes first
+	void evaluate(const board& b, results& r);
+
+	//// @brief Evaluates one swap on the calling thread
+	void evaluate(const board& b, const board_index& i1, const board_index& i2, swap_result& r) const;
+
+private:
+	void activate(board::ptr& b, const board_index& i, swap_result& r) const;
+	void cascade(board::ptr& b, matcher::matches& m, swap_result& r) const;
+	void destroy(board::ptr& b, const board_index& i, swap_result& r) const;
+
+private:
+	const matcher& m_matcher;
+	thread_pool m_pool;
+
+};
+
+#endif // CORE_MOVE_EVALUATOR_HPP
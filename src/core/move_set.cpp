@@ -0,0 +1,128 @@
+
+#include "move_set.hpp"
+
+#include <algorithm>
+#include <cassert>
+
+
+move_set::move_set(size_t r, size_t c)
+	: m_horizontal(r, c)
+	, m_vertical(r, c)
+{
+}
+
+void move_set::update(const board& b, const matcher& m, const bitboard& changed)
+{
+	assert(b.rows() == m_horizontal.rows() && b.columns() == m_horizontal.columns());
+	const size_t rows = b.rows();
+	const size_t cols = b.columns();
+	bitboard area = changed;
+	if (!m_initialized) {
+		area = ~bitboard(rows, cols);
+		m_initialized = true;
+	} else {
+		//// the swap is affected if a changed cell is in the reach of any swapped cell
+		const int reach = static_cast<int>(m.get_reach()) + 1;
+		bitboard h = area;
+		for (int d = 1; d <= reach; ++d) {
+			h |= area.shifted(0, d) | area.shifted(0, -d);
+		}
+		area = h;
+		for (int d = 1; d <= reach; ++d) {
+			area |= h.shifted(d, 0) | h.shifted(-d, 0);
+		}
+	}
+	if (area.none()) {
+		return;
+	}
+	//// with line based patterns a swap makes a match if it makes a run or a square,
+	//// so all swaps of the area's rows are checked at once (see board::get_swaps_mask())
+	bitboard horizontal_matches;
+	bitboard vertical_matches;
+	if (m.is_line_based()) {
+		size_t first_row = rows;
+		size_t last_row = 0;
+		area.for_each([&first_row, &last_row](const board_index& i) {
+			first_row = std::min(first_row, i.row());
+			last_row = std::max(last_row, i.row());
+		});
+		horizontal_matches = b.get_swaps_mask(false, first_row, last_row);
+		vertical_matches = b.get_swaps_mask(true, first_row, last_row);
+	}
+	area.for_each([&](const board_index& i) {
+		if (i.column() + 1 < cols) {
+			update(b, m, horizontal_matches, m_horizontal, i, board_index(i.row(), i.column() + 1));
+		}
+		if (i.row() + 1 < rows) {
+			update(b, m, vertical_matches, m_vertical, i, board_index(i.row() + 1, i.column()));
+		}
+	});
+}
+
+size_t move_set::count() const noexcept
+{
+	return m_count;
+}
+
+bool move_set::any() const noexcept
+{
+	return m_count != 0;
+}
+
+void move_set::enumerate(board::moves& moves) const
+{
+	moves.clear();
+	moves.reserve(m_count);
+	//// the masks are merged to keep row-major order
+	const bitboard all = m_horizontal | m_vertical;
+	all.for_each([this, &moves](const board_index& i) {
+		if (m_horizontal.test(i)) {
+			moves.push_back(std::make_pair(i, board_index(i.row(), i.column() + 1)));
+		}
+		if (m_vertical.test(i)) {
+			moves.push_back(std::make_pair(i, board_index(i.row() + 1, i.column())));
+		}
+	});
+}
+
+bool move_set::contains(const board_index& i1, const board_index& i2) const noexcept
+{
+	const board_index& first = i1 < i2 ? i1 : i2;
+	const board_index& second = i1 < i2 ? i2 : i1;
+	if (first.row() == second.row() && first.column() + 1 == second.column()) {
+		return m_horizontal.test(first);
+	} else if (first.column() == second.column() && first.row() + 1 == second.row()) {
+		return m_vertical.test(first);
+	}
+	return false;
+}
+
+bool move_set::is_valid(const board& b, const matcher& m, const bitboard& matches, const board_index& i1, const board_index& i2) const
+{
+	const cell c1 = b.get_cell(i1);
+	const cell c2 = b.get_cell(i2);
+	if (c1.is_empty() || c2.is_empty()) {
+		return false;
+	} else if (c1.is_booster() || c2.is_booster()) {
+		//// swapping two boosters isn't allowed
+		return !(c1.is_booster() && c2.is_booster());
+	} else if (matches.rows() != 0) {
+		return matches.test(i1);
+	}
+	return m.swap_match(b, i1, i2);
+}
+
+void move_set::update(const board& b, const matcher& m, const bitboard& matches, bitboard& swaps, const board_index& i1, const board_index& i2)
+{
+	const bool valid = is_valid(b, m, matches, i1, i2);
+	if (valid == swaps.test(i1)) {
+		return;
+	}
+	if (valid) {
+		swaps.set(i1);
+		++m_count;
+	} else {
+		swaps.reset(i1);
+		--m_count;
+	}
+}
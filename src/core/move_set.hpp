@@ -0,0 +1,69 @@
+#ifndef CORE_MOVE_SET_HPP
+#define CORE_MOVE_SET_HPP
+
+#include "bitboard.hpp"
+#include "board.hpp"
+#include "board_index.hpp"
+#include "matcher.hpp"
+
+#include <memory>
+
+
+//// @class move_set
+//// @brief Keeps the valid swaps of the board
+//// A swap of neighbours is valid if it makes a match or if one of the swapped items is a booster (but not both).
+//// Swaps are kept as two masks: a bit per cell for the swap with its right neighbour and with its bottom one.
+//// The set is updated only around the cells which were changed (see board::get_changed_mask()),
+//// so the valid moves can be counted or listed without checking all swaps of the board.
+//// If all patterns are line based (see matcher::is_line_based()), the swaps of the changed rows
+//// are checked at once with vectorized kernel, otherwise every swap is checked with the matcher.
+class move_set
+{
+public:
+    using ptr = std::unique_ptr<move_set>;
+
+public:
+	//// @brief Constructor
+	//// @param[in] r The rows count
+	//// @param[in] c The columns count
+	//// @note Creates an empty set, all cells are considered as changed on the first update
+	move_set(size_t r, size_t c);
+
+	//// @brief Destructor
+	~move_set() = default;
+
+public:
+	//// @brief Updates the swaps which can be affected by given changed cells
+	//// @param[in] b The board
+	//// @param[in] m The matcher which decides if swap makes a match
+	//// @param[in] changed The changed cells of the board after the last update
+	void update(const board& b, const matcher& m, const bitboard& changed);
+
+	//// @brief Gets the count of valid swaps
+	size_t count() const noexcept;
+
+	//// @brief Checks if there is any valid swap
+	bool any() const noexcept;
+
+	//// @brief Gets the valid swaps
+	//// @note The swaps are in row-major order of the first (left or top) index
+	void enumerate(board::moves&) const;
+
+	//// @brief Checks if given swap is valid
+	//// @note The indexes should be neighbours
+	bool contains(const board_index&, const board_index&) const noexcept;
+
+private:
+	//// the matches mask is empty (0x0) if the swaps should be checked with the matcher
+	bool is_valid(const board&, const matcher&, const bitboard&, const board_index&, const board_index&) const;
+	void update(const board&, const matcher&, const bitboard&, bitboard&, const board_index&, const board_index&);
+
+private:
+	bitboard m_horizontal;
+	bitboard m_vertical;
+	size_t m_count = 0;
+	bool m_initialized = false;
+
+};
+
+#endif // CORE_MOVE_SET_HPP
@@ -33,7 +33,14 @@ public:
 	//// Creates a new objective with given configuration
     objectives(const config::ptr&);
 
+	//// @brief Destructor
+	//// Deletes the objectives
+    ~objectives();
+
 public:
+	//// @brief Recreates the objectives with given configuration (e.g. when the game is restarted)
+    void reset(const config::ptr&);
+
 	//// @brief Checks if all objectives are completed
     bool completed() const noexcept;
 
@@ -1,313 +1,496 @@
-
-#include "match_data.hpp"
-#include "patterns.hpp"
-
-#include <cassert>
-#include <iostream>
-
-
-/// pattern
-bool pattern::is_figure(const board::ptr& b, const index& i) const noexcept
-{
-	assert(b != nullptr);
-	if (!i.is_valid()) {
-		return false;
-	}
-	board_item* item = b->get_item(i);
-	return item != nullptr ? item->is_figure() : false;
-}
-
-figure::color pattern::get_color(const board::ptr& b, const index& i) const
-{
-    if (!i.is_valid()) {
-        return figure::color::UNDEFINED;
-    }
-	if (b->is_proxy_item(i)) {
-		return b->get_proxy_color(i);
-	}
-	if (!is_figure(b, i)) {
-		return figure::color::UNDEFINED;
-	}
-	return static_cast<figure*>(b->get_item(i))->get_color();
-}
-
-
-/// vertical pattern
-bool horizontal_pattern::match(const board::ptr& b, const index& i, match_data& md)
-{
-    assert(i.is_valid());
-	if (!is_figure(b, i)) {
-		return false;
-	}
-    const figure::color& c = get_color(b, i);
-	return match(b, i, c, md);
-}
-
-bool horizontal_pattern::match(const board::ptr& b, const proxy_figure* f)
-{
-	assert(b);
-	assert(f != nullptr);
-	match_data md;
-	return match(b, f->get_index(), f->get_color(), md);
-}
-
-pattern::type horizontal_pattern::get_type() const noexcept
-{
-    return pattern::type::horizontal;
-}
-
-bool horizontal_pattern::match(const board::ptr& b, const index& i, const figure::color& c, match_data& md)
-{
-	assert(b);
-	assert(i.is_valid());
-	assert(c != figure::color::UNDEFINED);
-	size_t it = i.column();
-	std::list<index> mi;
-	mi.push_back(i);
-	while (get_color(b, index(i.row(), --it)) == c) {
-		mi.push_back(index(i.row(), it));
-	}
-	it = i.column();
-	while (get_color(b, index(i.row(), ++it)) == c) {
-		mi.push_back(index(i.row(), it));
-	}
-	const size_t count = mi.size();
-	const bool matched = count > 2;
-	if (matched) {
-		md.set_indexes(mi);
-		md.set_pattern_type(pattern::type::horizontal);
-	}
-	return matched;
-}
-
-
-/// horizontal pattern
-bool vertical_pattern::match(const board::ptr& b, const index& i, match_data& md)
-{
-    assert(i.is_valid());
-	if (!is_figure(b, i)) {
-		return false;
-	}
-    const figure::color& c = get_color(b, i);
-	return match(b, i, c, md);
-}
-
-bool vertical_pattern::match(const board::ptr& b, const proxy_figure* f)
-{
-	assert(b);
-	assert(f != nullptr);
-	match_data md;
-	return match(b, f->get_index(), f->get_color(), md);
-}
-
-
-pattern::type vertical_pattern::get_type() const noexcept
-{
-    return pattern::type::vertical;
-}
-
-bool vertical_pattern::match(const board::ptr& b, const index& i, const figure::color& c, match_data& md)
-{
-	assert(b);
-	assert(i.is_valid());
-	assert(c != figure::color::UNDEFINED);
-	size_t it = i.row();
-	std::list<index> mi;
-	mi.push_back(i);
-	while (get_color(b, index(--it, i.column())) == c) {
-		mi.push_back(index(it, i.column()));
-	}
-	it = i.row();
-	while (get_color(b, index(++it, i.column())) == c) {
-		mi.push_back(index(it, i.column()));
-	}
-	const size_t count = mi.size();
-	const bool matched = count > 2;
-	if (matched) {
-		md.set_indexes(mi);
-		md.set_pattern_type(pattern::type::vertical);
-	}
-	return matched;
-}
-
-
-/// radial pattern
-bool radial_pattern::match(const board::ptr& b, const index& i, match_data& md)
-{
-    assert(i.is_valid());
-	if (!is_figure(b, i)) {
-		return false;
-	}
-    const figure::color& c = get_color(b, i);
-	return match(b, i, c, md);
-}
-
-bool radial_pattern::match(const board::ptr& b, const proxy_figure* f)
-{
-	assert(b);
-	assert(f);
-	match_data md;
-	return match(b, f->get_index(), f->get_color(), md);
-}
-
-bool radial_pattern::match(const board::ptr& b, const index& i, const figure::color& c, match_data& md)
-{
-	assert(b);
-	assert(i.is_valid());
-	assert(c != figure::color::UNDEFINED);
-	std::list<index> mi;
-	index neighbour = index(i.row(), i.column() - 1);
-	if (_match(b, c, i, neighbour, mi)) {
-		md.set_indexes(mi);
-		md.set_pattern_type(pattern::type::radial);
-		return true;
-	}
-	mi.clear();
-	neighbour = index(i.row(), i.column() + 1);
-	if (_match(b, c, i, neighbour, mi)) {
-		md.set_indexes(mi);
-		md.set_pattern_type(pattern::type::radial);
-		return true;
-	}
-	return false;
-}
-
-pattern::type radial_pattern::get_type() const noexcept
-{
-    return pattern::type::radial;
-}
-
-bool radial_pattern::_match(const board::ptr& b, const figure::color& c, const index& i, const index& n, std::list<index>& mi)
-{
-    if (get_color(b, n) == c) {
-        if (match_top(b, c, i, n, mi)) {
-            return true;
-        } else if (match_bottom(b, c, i, n, mi)) {
-            return true;
-        }
-    }
-    return false;
-}
-
-bool radial_pattern::match_top(const board::ptr& b, const figure::color& c, const index& i, const index& n, std::list<index>& mi)
-{
-    index i1(i.row() - 1, i.column());
-    index i2(n.row() - 1, n.column());
-    const bool matched = get_color(b, i1) == c && get_color(b, i2) == c;
-    if (matched) {
-        mi = { i, n, i1, i2 };
-    }
-    return matched;
-}
-
-bool radial_pattern::match_bottom(const board::ptr& b, const figure::color& c, const index& i, const index& n, std::list<index>& mi)
-{
-    index i1(i.row() + 1, i.column());
-    index i2(n.row() + 1, n.column());
-    const bool matched = get_color(b, i1) == c && get_color(b, i2) == c;
-    if (matched) {
-        mi = { i, n, i1, i2 };
-    }
-    return matched;
-}
-
-
-/// T patern
-bool t_pattern::match(const board::ptr& b, const index& i, match_data& md)
-{
-    assert(i.is_valid());
-	if (!is_figure(b, i)) {
-		return false;
-	}
-    const figure::color c = get_color(b, i);
-	assert(c != figure::color::UNDEFINED);
-	std::list<index> tmp;
-    if (match_t_base_horizontal(b, c, i, tmp)) {
-        if (match_t_tails_vertical(b, c, i, tmp)) {
-            md.set_indexes(tmp);
-            md.set_pattern_type(pattern::type::t);
-            return true;
-        }
-    }
-    tmp.clear();
-    if (match_t_base_vertical(b, c, i, tmp)) {
-        if (match_t_tails_horizontal(b, c, i, tmp)) {
-            md.set_indexes(tmp);
-            md.set_pattern_type(pattern::type::t);
-            return true;
-        }
-    }
-    return false;
-}
-
-bool t_pattern::match(const board::ptr&, const proxy_figure*)
-{
-	return false;
-}
-
-pattern::type t_pattern::get_type() const noexcept
-{
-    return pattern::type::t;
-}
-
-bool t_pattern::match_t_base_vertical(const board::ptr& b, const figure::color& c, const index& i, std::list<index>& mi)
-{
-    index ti1(i.row() - 1, i.column());
-    index ti2(i.row() - 2, i.column());
-    if (get_color(b, ti1) == c && get_color(b, ti2) == c) {
-        mi.push_back(ti1);
-        mi.push_back(ti2);
-        return true;
-    }
-    index bi1(i.row() + 1, i.column());
-    index bi2(i.row() + 2, i.column());
-    if (get_color(b, bi1) == c && get_color(b, bi2) == c) {
-        mi.push_back(bi1);
-        mi.push_back(bi2);
-        return true;
-    }
-    return false;
-}
-
-bool t_pattern::match_t_base_horizontal(const board::ptr& b, const figure::color& c, const index& i, std::list<index>& mi)
-{
-    index ti1(i.row(), i.column() - 1);
-    index ti2(i.row(), i.column() - 2);
-    if (get_color(b, ti1) == c && get_color(b, ti2) == c) {
-        mi.push_back(ti1);
-        mi.push_back(ti2);
-        return true;
-    }
-    index bi1(i.row(), i.column() + 1);
-    index bi2(i.row(), i.column() + 2);
-    if (get_color(b, bi1) == c && get_color(b, bi2) == c) {
-        mi.push_back(bi1);
-        mi.push_back(bi2);
-        return true;
-    }
-    return false;
-}
-
-bool t_pattern::match_t_tails_vertical(const board::ptr& b, const figure::color& c, const index& i, std::list<index>& mi)
-{
-    index i1(i.row() - 1, i.column());
-    index i2(i.row() + 1, i.column());
-    const bool matched = get_color(b, i1) == c && get_color(b, i2) == c;
-    if (matched) {
-        mi.push_back(i1);
-        mi.push_back(i2);
-    }
-    return matched;
-}
-
-bool t_pattern::match_t_tails_horizontal(const board::ptr& b, const figure::color& c, const index& i, std::list<index>& mi)
-{
-    index i1(i.row(), i.column() - 1);
-    index i2(i.row(), i.column() + 1);
-    const bool matched = get_color(b, i1) == c && get_color(b, i2) == c;
-    if (matched) {
-        mi.push_back(i1);
-        mi.push_back(i2);
-    }
-    return matched;
-}
+
+#include "exceptions.hpp"
+#include "match_data.hpp"
+#include "patterns.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdlib>
+#include <iostream>
+#include <set>
+
+
+/// pattern
+bool pattern::is_figure(const swap_view& v, const board_index& i) const noexcept
+{
+	return v.get_cell(i).is_figure();
+}
+
+figure::color pattern::get_color(const swap_view& v, const board_index& i) const noexcept
+{
+	return v.get_color(i);
+}
+
+bool pattern::is_line_based() const noexcept
+{
+	return true;
+}
+
+bool pattern::get_placements(std::vector<uint32_t>& p) const
+{
+	p.clear();
+	return false;
+}
+
+bool pattern::add_match(const board_index& i, const match_data& md, bitboard& claimed, matches& m) const
+{
+	const span<const board_index> mi = md.get_indexes();
+	for (const auto& it : mi) {
+		if (claimed.test(it)) {
+			return false;
+		}
+	}
+	for (const auto& it : mi) {
+		claimed.set(it);
+	}
+	m.push_back(std::make_pair(i, md));
+	return true;
+}
+
+
+/// vertical pattern
+bool horizontal_pattern::match(const swap_view& v, const board_index& i, match_data& md) const
+{
+    assert(v.contains(i));
+	if (!is_figure(v, i)) {
+		return false;
+	}
+    const figure::color& c = get_color(v, i);
+	return match(v, i, c, md);
+}
+
+size_t horizontal_pattern::get_reach() const noexcept
+{
+	return 2;
+}
+
+bool horizontal_pattern::get_placements(std::vector<uint32_t>& p) const
+{
+	p = {
+		neighbourhood::bit(0, -2) | neighbourhood::bit(0, -1),
+		neighbourhood::bit(0, -1) | neighbourhood::bit(0, 1),
+		neighbourhood::bit(0, 1) | neighbourhood::bit(0, 2)
+	};
+	return true;
+}
+
+void horizontal_pattern::set_match(const swap_view& v, const board_index& i, size_t, match_data& md) const
+{
+	match(v, i, get_color(v, i), md);
+}
+
+void horizontal_pattern::scan(const board& b, bitboard& claimed, matches& m) const
+{
+	board_kernels::runs runs;
+	b.get_runs(false, runs);
+	for (const auto& it : runs) {
+		match_data md;
+		for (size_t k = 0; k < it.second; ++k) {
+			md.add_index(board_index(it.first.row(), it.first.column() + k));
+		}
+		md.set_pattern_type(pattern::type::horizontal);
+		if (it.second > 3) {
+			md.set_booster_type(booster::type::vertical);
+		}
+		add_match(it.first, md, claimed, m);
+	}
+}
+
+pattern::type horizontal_pattern::get_type() const noexcept
+{
+    return pattern::type::horizontal;
+}
+
+bool horizontal_pattern::match(const swap_view& v, const board_index& i, const figure::color& c, match_data& md) const
+{
+	assert(v.contains(i));
+	assert(c != figure::color::UNDEFINED);
+	size_t first = i.column();
+	while (get_color(v, board_index(i.row(), first - 1)) == c) {
+		--first;
+	}
+	size_t last = i.column();
+	while (get_color(v, board_index(i.row(), last + 1)) == c) {
+		++last;
+	}
+	const size_t count = last - first + 1;
+	const bool matched = count > 2;
+	if (matched) {
+		md.add_index(i);
+		for (size_t it = i.column(); it-- > first;) {
+			md.add_index(board_index(i.row(), it));
+		}
+		for (size_t it = i.column() + 1; it <= last; ++it) {
+			md.add_index(board_index(i.row(), it));
+		}
+		md.set_pattern_type(pattern::type::horizontal);
+		if (count > 3) {
+			md.set_booster_type(booster::type::vertical);
+		}
+	}
+	return matched;
+}
+
+
+/// horizontal pattern
+bool vertical_pattern::match(const swap_view& v, const board_index& i, match_data& md) const
+{
+    assert(v.contains(i));
+	if (!is_figure(v, i)) {
+		return false;
+	}
+    const figure::color& c = get_color(v, i);
+	return match(v, i, c, md);
+}
+
+
+size_t vertical_pattern::get_reach() const noexcept
+{
+	return 2;
+}
+
+bool vertical_pattern::get_placements(std::vector<uint32_t>& p) const
+{
+	p = {
+		neighbourhood::bit(-2, 0) | neighbourhood::bit(-1, 0),
+		neighbourhood::bit(-1, 0) | neighbourhood::bit(1, 0),
+		neighbourhood::bit(1, 0) | neighbourhood::bit(2, 0)
+	};
+	return true;
+}
+
+void vertical_pattern::set_match(const swap_view& v, const board_index& i, size_t, match_data& md) const
+{
+	match(v, i, get_color(v, i), md);
+}
+
+void vertical_pattern::scan(const board& b, bitboard& claimed, matches& m) const
+{
+	board_kernels::runs runs;
+	b.get_runs(true, runs);
+	for (const auto& it : runs) {
+		match_data md;
+		for (size_t k = 0; k < it.second; ++k) {
+			md.add_index(board_index(it.first.row() + k, it.first.column()));
+		}
+		md.set_pattern_type(pattern::type::vertical);
+		if (it.second > 3) {
+			md.set_booster_type(booster::type::horizontal);
+		}
+		add_match(it.first, md, claimed, m);
+	}
+}
+
+pattern::type vertical_pattern::get_type() const noexcept
+{
+    return pattern::type::vertical;
+}
+
+bool vertical_pattern::match(const swap_view& v, const board_index& i, const figure::color& c, match_data& md) const
+{
+	assert(v.contains(i));
+	assert(c != figure::color::UNDEFINED);
+	size_t first = i.row();
+	while (get_color(v, board_index(first - 1, i.column())) == c) {
+		--first;
+	}
+	size_t last = i.row();
+	while (get_color(v, board_index(last + 1, i.column())) == c) {
+		++last;
+	}
+	const size_t count = last - first + 1;
+	const bool matched = count > 2;
+	if (matched) {
+		md.add_index(i);
+		for (size_t it = i.row(); it-- > first;) {
+			md.add_index(board_index(it, i.column()));
+		}
+		for (size_t it = i.row() + 1; it <= last; ++it) {
+			md.add_index(board_index(it, i.column()));
+		}
+		md.set_pattern_type(pattern::type::vertical);
+		if (count > 3) {
+			md.set_booster_type(booster::type::horizontal);
+		}
+	}
+	return matched;
+}
+
+
+/// shape pattern
+namespace {
+
+using shape_cells = std::vector<std::pair<int, int>>;
+
+//// Moves the cells to the top left corner
+void normalize(shape_cells& cells)
+{
+	int min_row = cells.front().first;
+	int min_col = cells.front().second;
+	for (const auto& it : cells) {
+		min_row = std::min(min_row, it.first);
+		min_col = std::min(min_col, it.second);
+	}
+	for (auto& it : cells) {
+		it.first -= min_row;
+		it.second -= min_col;
+	}
+}
+
+bool has_cell(const shape_cells& cells, int r, int c)
+{
+	return std::find(cells.begin(), cells.end(), std::make_pair(r, c)) != cells.end();
+}
+
+bool has_line(const shape_cells& cells)
+{
+	for (const auto& it : cells) {
+		const int r = it.first;
+		const int c = it.second;
+		if (has_cell(cells, r, c + 1) && has_cell(cells, r, c + 2)) {
+			return true;
+		} else if (has_cell(cells, r + 1, c) && has_cell(cells, r + 2, c)) {
+			return true;
+		} else if (has_cell(cells, r, c + 1) && has_cell(cells, r + 1, c) && has_cell(cells, r + 1, c + 1)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+}
+
+shape_pattern::shape_pattern(const description& d, const type& t)
+	: m_type(t)
+{
+	compile(d);
+}
+
+shape_pattern::shape_pattern(const description& d, const booster::type& b, const type& t)
+	: m_type(t)
+	, m_has_booster(true)
+	, m_booster_type(b)
+{
+	compile(d);
+}
+
+void shape_pattern::validate(const description& d)
+{
+	if (d.empty() || d.size() > max_size) {
+		throw pattern_error("the shape must have 1 - " + std::to_string(max_size) + " rows");
+	}
+	size_t cells_count = 0;
+	size_t markers_count = 0;
+	for (const auto& row : d) {
+		if (row.size() != d.front().size() || row.empty() || row.size() > max_size) {
+			throw pattern_error("the shape rows must have same length 1 - " + std::to_string(max_size));
+		}
+		for (const char ch : row) {
+			if (ch == 'o') {
+				++cells_count;
+			} else if (ch == 'x') {
+				++cells_count;
+				++markers_count;
+			} else if (ch != '.' && ch != ' ') {
+				throw pattern_error("unknown shape cell '" + std::string(1, ch) + "'");
+			}
+		}
+	}
+	if (cells_count < min_cells_count) {
+		throw pattern_error("the shape must have at least " + std::to_string(min_cells_count) + " cells");
+	}
+	if (markers_count > 1) {
+		throw pattern_error("the shape must have at most one booster cell");
+	}
+}
+
+void shape_pattern::compile(const description& d)
+{
+	validate(d);
+	//// the marker is kept as the first cell
+	shape_cells cells;
+	for (size_t r = 0; r < d.size(); ++r) {
+		for (size_t c = 0; c < d[r].size(); ++c) {
+			const char ch = d[r][c];
+			if (ch == 'x') {
+				cells.insert(cells.begin(), std::make_pair(static_cast<int>(r), static_cast<int>(c)));
+			} else if (ch == 'o') {
+				cells.push_back(std::make_pair(static_cast<int>(r), static_cast<int>(c)));
+			}
+		}
+	}
+	m_cells_count = cells.size();
+	m_line_based = has_line(cells);
+	m_tables.clear();
+	m_origins.clear();
+	std::set<shape_cells> variants;
+	for (size_t mirror = 0; mirror < 2; ++mirror) {
+		for (size_t rotation = 0; rotation < 4; ++rotation) {
+			shape_cells variant;
+			for (const auto& it : cells) {
+				int r = it.first;
+				int c = mirror ? -it.second : it.second;
+				for (size_t k = 0; k < rotation; ++k) {
+					const int tmp = r;
+					r = c;
+					c = -tmp;
+				}
+				variant.push_back(std::make_pair(r, c));
+			}
+			normalize(variant);
+			shape_cells sorted = variant;
+			std::sort(sorted.begin(), sorted.end());
+			if (!variants.insert(sorted).second) {
+				continue;
+			}
+			//// a table per cell, the first one is relative to the marker
+			m_origins.push_back(m_tables.size());
+			for (const auto& anchor : variant) {
+				for (const auto& it : variant) {
+					m_tables.push_back(offset{ static_cast<int8_t>(it.first - anchor.first),
+						static_cast<int8_t>(it.second - anchor.second) });
+				}
+			}
+		}
+	}
+}
+
+bool shape_pattern::match(const swap_view& v, const board_index& i, match_data& md) const
+{
+	assert(v.contains(i));
+	if (!is_figure(v, i)) {
+		return false;
+	}
+	const figure::color c = get_color(v, i);
+	for (size_t t = 0; t < m_tables.size(); t += m_cells_count) {
+		if (fits(v, i, &m_tables[t], c)) {
+			collect(i, &m_tables[t], md);
+			return true;
+		}
+	}
+	return false;
+}
+
+void shape_pattern::scan(const board& b, bitboard& claimed, matches& m) const
+{
+	//// the anchors of all colors: the anchor's color is the color of its cell
+	std::vector<bitboard> anchors(m_origins.size(), bitboard(b.rows(), b.columns()));
+	std::vector<bitboard> color_anchors;
+	bitboard all(b.rows(), b.columns());
+	for (size_t c = 0; c < figure::colors_count; ++c) {
+		const bitboard& plane = b.get_color_mask(static_cast<figure::color>(c));
+		if (plane.none()) {
+			continue;
+		}
+		find_anchors(plane, color_anchors);
+		for (size_t k = 0; k < anchors.size(); ++k) {
+			anchors[k] |= color_anchors[k];
+			all |= color_anchors[k];
+		}
+	}
+	all.for_each([&](const board_index& i) {
+		if (claimed.test(i)) {
+			return;
+		}
+		for (size_t k = 0; k < anchors.size(); ++k) {
+			if (anchors[k].test(i)) {
+				match_data md;
+				collect(i, &m_tables[m_origins[k]], md);
+				if (add_match(i, md, claimed, m)) {
+					return;
+				}
+			}
+		}
+	});
+}
+
+void shape_pattern::find_anchors(const bitboard& plane, std::vector<bitboard>& anchors) const
+{
+	anchors.clear();
+	for (const size_t t : m_origins) {
+		bitboard a = plane;
+		for (size_t k = 0; k < m_cells_count && a.any(); ++k) {
+			const offset& o = m_tables[t + k];
+			if (o.row != 0 || o.column != 0) {
+				a &= plane.shifted(-o.row, -o.column);
+			}
+		}
+		anchors.push_back(a);
+	}
+}
+
+pattern::type shape_pattern::get_type() const noexcept
+{
+	return m_type;
+}
+
+bool shape_pattern::is_line_based() const noexcept
+{
+	return m_line_based;
+}
+
+size_t shape_pattern::get_cells_count() const noexcept
+{
+	return m_cells_count;
+}
+
+size_t shape_pattern::get_variants_count() const noexcept
+{
+	return m_origins.size();
+}
+
+bool shape_pattern::fits(const swap_view& v, const board_index& i, const offset* o, const figure::color& c) const
+{
+	for (size_t k = 0; k < m_cells_count; ++k) {
+		//// negative coordinates become out of range indexes
+		const board_index n(i.row() + o[k].row, i.column() + o[k].column);
+		if (get_color(v, n) != c) {
+			return false;
+		}
+	}
+	return true;
+}
+
+size_t shape_pattern::get_reach() const noexcept
+{
+	size_t reach = 0;
+	for (const auto& o : m_tables) {
+		reach = std::max(reach, static_cast<size_t>(std::max(std::abs(o.row), std::abs(o.column))));
+	}
+	return reach;
+}
+
+bool shape_pattern::get_placements(std::vector<uint32_t>& p) const
+{
+	p.clear();
+	for (size_t t = 0; t < m_tables.size(); t += m_cells_count) {
+		uint32_t mask = 0;
+		for (size_t k = 0; k < m_cells_count; ++k) {
+			const offset& o = m_tables[t + k];
+			if (std::abs(o.row) > neighbourhood::radius || std::abs(o.column) > neighbourhood::radius) {
+				p.clear();
+				return false;
+			}
+			mask |= neighbourhood::bit(o.row, o.column);
+		}
+		p.push_back(mask);
+	}
+	return true;
+}
+
+void shape_pattern::set_match(const swap_view&, const board_index& i, size_t p, match_data& md) const
+{
+	assert(p * m_cells_count < m_tables.size());
+	collect(i, &m_tables[p * m_cells_count], md);
+}
+
+void shape_pattern::collect(const board_index& i, const offset* o, match_data& md) const
+{
+	for (size_t k = 0; k < m_cells_count; ++k) {
+		md.add_index(board_index(i.row() + o[k].row, i.column() + o[k].column));
+	}
+	md.set_pattern_type(m_type);
+	if (m_has_booster) {
+		md.set_booster_type(m_booster_type);
+	}
+}
@@ -1,155 +1,311 @@
-
-#ifndef PATTERNS_HPP
-#define PATTERNS_HPP
-
-#include "board.hpp"
-#include "figure.hpp"
-#include "index.hpp"
-#include "proxy_figure.hpp"
-
-#include <list>
-#include <memory>
-
-
-class match_data;
-
-
-//// @class pattern
-//// @brief Interface of patterns
-class pattern
-{
-public:
-    enum class type {
-        UNDEFINED = -1,
-        horizontal = 0,
-        vertical,
-        radial,
-        t
-    };
-
-public:
-	//// @brief Constructor
-    pattern() = default;
-
-	//// @brief Destructor
-    virtual ~pattern() = default;
-
-public:
-	//// @brief Match is a predefined combination of same color figures.
-	//// @return true if found concrete combination - false otherwise
-	//// @note match() will return false if matched colors count is less or equal 2
-    virtual bool match(const board::ptr&, const index&, match_data&) = 0;
-
-	//// @brief Match is a predefined combination of same color figures.
-	////		This function uses proxy figure for matching pattern.
-	////		It means that current index and color will be used from proxy figure and not get from board.
-	//// @return true if found a concrete combination - false otherwise
-	//// @note match() will return false if matched colors count is less or equal 2
-	//// @note For just checking available moves count no need to return match data if don't need to hint something!
-	virtual bool match(const board::ptr&, const proxy_figure*) = 0;
-
-	//// @brief Gets the pattern type
-    virtual type get_type() const noexcept = 0;
-
-protected:
-	//// @brief Gets the figure's color from given index
-    figure::color get_color(const board::ptr&, const index&) const;
-
-	//// @brief Checks if item with given index is figure or not(not empty or booster)
-	bool is_figure(const board::ptr&, const index&) const noexcept;
-};
-
-
-//// @class horizontal_pattern
-class horizontal_pattern : public pattern
-{
-public:
-	//// @brief Horizontal combination of same color figures.
-	//// @return true if found horizontal combination
-    bool match(const board::ptr&, const index&, match_data&) override;
-
-	//// @brief Horizontal combination of same color figures.
-	//// @return true if found horizontal combination
-	//// @note Starting figure is a proxy figure
-	bool match(const board::ptr&, const proxy_figure*) override;
-
-	//// @brief Gets the pattern type
-    pattern::type get_type() const noexcept override;
-
-private:
-	bool match(const board::ptr&, const index&, const figure::color&, match_data&);
-
-};
-
-
-//// @class vertical_pattern
-class vertical_pattern : public pattern
-{
-public:
-	//// @brief Vertical combination of same color figures.
-	//// @return true if found vertical combination
-    bool match(const board::ptr&, const index&, match_data&) override;
-	
-	//// @brief Vertical combination of same color figures.
-	//// @return true if found vertical combination
-	//// @note Starting figure is a proxy figure
-	bool match(const board::ptr&, const proxy_figure*) override;
-
-	//// @brief Gets the pattern type
-    pattern::type get_type() const noexcept override;
-
-private:
-	bool match(const board::ptr&, const index&, const figure::color&, match_data&);
-
-};
-
-
-//// @class vertical_pattern
-class radial_pattern : public pattern
-{
-public:
-	//// @brief Radial combination of same color figures.
-	//// @return true if found radial(squared) combination
-    bool match(const board::ptr&, const index&, match_data&) override;
-
-	//// @brief Radial combination of same color figures.
-	//// @return true if found radial(squared) combination
-	//// @note Starting figure is a proxy figure
-	bool match(const board::ptr&, const proxy_figure*) override;
-
-    /// @brief Gets the pattern type
-    pattern::type get_type() const noexcept override;
-
-private:
-	bool match(const board::ptr&, const index&, const figure::color&, match_data&);
-    bool _match(const board::ptr&, const figure::color&, const index&, const index&, std::list<index>&);
-    bool match_top(const board::ptr&, const figure::color&, const index&, const index&, std::list<index>&);
-    bool match_bottom(const board::ptr&, const figure::color&, const index&, const index&, std::list<index>&);
-
-};
-
-
-//// @class t_pattern
-class t_pattern : public pattern
-{
-public:
-	//// @brief Vertical combination of same color figures.
-	//// @return true if found vertical combination
-    bool match(const board::ptr&, const index&, match_data&) override;
-
-	//// Don't need to match this pattern in proxy matching
-	//// This is because it contains vertical and horizontal patterns
-	bool match(const board::ptr&, const proxy_figure*) override;
-
-	//// @brief Gets the pattern type
-    pattern::type get_type() const noexcept override;
-
-private:
-    bool match_t_base_vertical(const board::ptr&, const figure::color&, const index&, std::list<index>&);
-    bool match_t_base_horizontal(const board::ptr&, const figure::color&, const index&, std::list<index>&);
-    bool match_t_tails_vertical(const board::ptr&, const figure::color&, const index&, std::list<index>&);
-    bool match_t_tails_horizontal(const board::ptr&, const figure::color&, const index&, std::list<index>&);
-
-};
-
-#endif // PATTERNS_HPP
+#ifndef PATTERNS_HPP
+#define PATTERNS_HPP
+
+#include "bitboard.hpp"
+#include "board.hpp"
+#include "board_index.hpp"
+#include "boosters.hpp"
+#include "figure.hpp"
+#include "swap_view.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+
+class match_data;
+
+
+//// The 5x5 neighbourhood of a cell
+//// Neighbourhood mask keeps a bit per neighbour cell (24 bits), the cell itself hasn't a bit.
+//// The bits are in row-major order: bit 0 is the top left neighbour (-2, -2), bit 23 is the bottom right one (2, 2).
+namespace neighbourhood {
+
+//// @brief The maximum row or column distance of neighbours - 2
+constexpr int radius = 2;
+
+//// @brief The rows or columns count of neighbourhood - 5
+constexpr size_t size = 2 * radius + 1;
+
+//// @brief The count of neighbours - 24
+constexpr size_t bits_count = size * size - 1;
+
+//// @brief Gets the bit of neighbour with given offset
+//// @return 0 if the offset is outside of neighbourhood or it is the cell itself
+constexpr uint32_t bit(int dr, int dc) noexcept
+{
+	return (dr < -radius || dr > radius || dc < -radius || dc > radius || (dr == 0 && dc == 0)) ? 0 :
+		uint32_t(1) << ((dr + radius) * static_cast<int>(size) + dc + radius - ((dr > 0 || (dr == 0 && dc > 0)) ? 1 : 0));
+}
+
+}
+
+
+//// @class pattern
+//// @brief Interface of patterns
+class pattern
+{
+public:
+    enum class type {
+        UNDEFINED = -1,
+        horizontal = 0,
+        vertical,
+        radial,
+        t,
+        custom
+    };
+
+    using ptr = std::unique_ptr<pattern>;
+
+	//// The matches found by scan(): the index where booster should be created and the match data
+	using matches = std::vector<std::pair<board_index, match_data>>;
+
+public:
+	//// @brief Constructor
+    pattern() = default;
+
+	//// @brief Destructor
+    virtual ~pattern() = default;
+
+public:
+	//// @brief Match is a predefined combination of same color figures.
+	//// @return true if found concrete combination - false otherwise
+	//// @note match() will return false if matched colors count is less or equal 2
+	//// @note Cells are taken from given view, so the same pattern can be checked for a hypothetical swap
+    virtual bool match(const swap_view&, const board_index&, match_data&) const = 0;
+
+	//// @brief Finds all matches of the pattern in the board
+	//// @param[in] b The board
+	//// @param[in,out] claimed The cells of already found matches, found matches' cells are added
+	//// @param[out] m The found matches are appended
+	//// @note Matches which have claimed cells are skipped, so the matches of one scan don't overlap
+    virtual void scan(const board& b, bitboard& claimed, matches& m) const = 0;
+
+	//// @brief Gets the pattern type
+    virtual type get_type() const noexcept = 0;
+
+	//// @brief Checks if every match of the pattern has a run of 3 or a 2x2 square
+	//// If it is so, board masks (see board::get_runs_mask(), board::get_swaps_mask()) can be used
+	//// to check if there are matches without matching the pattern
+	virtual bool is_line_based() const noexcept;
+
+	//// @brief Gets the maximum row or column distance from a cell to the cells which decide if the cell matches
+	//// E.g. a cell's run of 3 is decided by cells up to 2 cells away
+	virtual size_t get_reach() const noexcept = 0;
+
+	//// @brief Gets the placements of the pattern around a cell as neighbourhood masks (see neighbourhood)
+	//// The pattern matches if all neighbours of any placement have the cell's color.
+	//// The placements are in the same order which match() checks them.
+	//// @return false if the pattern has cells outside of neighbourhood
+	virtual bool get_placements(std::vector<uint32_t>&) const;
+
+	//// @brief Collects the match of given placement
+	//// @param[in] v The view
+	//// @param[in] i The index
+	//// @param[in] p The placement number (see get_placements())
+	//// @param[out] md The match data
+	//// @note The placement should match
+	virtual void set_match(const swap_view& v, const board_index& i, size_t p, match_data& md) const = 0;
+
+protected:
+	//// @brief Gets the figure's color from given index
+    figure::color get_color(const swap_view&, const board_index&) const noexcept;
+
+	//// @brief Checks if item with given index is figure or not(not empty or booster)
+	bool is_figure(const swap_view&, const board_index&) const noexcept;
+
+	//// @brief Adds the match to found matches if none of its cells are claimed
+	//// @return true if the match was added
+	bool add_match(const board_index&, const match_data&, bitboard&, matches&) const;
+};
+
+
+//// @class horizontal_pattern
+//// @note Creates vertical booster for more than 3 figures
+class horizontal_pattern : public pattern
+{
+public:
+	//// @brief Horizontal combination of same color figures.
+	//// @return true if found horizontal combination
+    bool match(const swap_view&, const board_index&, match_data&) const override;
+
+	//// @brief Gets the reach of runs of 3 - 2
+	size_t get_reach() const noexcept override;
+
+	//// @brief Gets the runs of 3 with the cell
+	bool get_placements(std::vector<uint32_t>&) const override;
+
+	//// @brief Collects the whole run of the cell
+	void set_match(const swap_view&, const board_index&, size_t, match_data&) const override;
+
+	//// @brief Finds the horizontal runs of the board row by row (see board::get_runs())
+	void scan(const board&, bitboard&, matches&) const override;
+
+	//// @brief Gets the pattern type
+    pattern::type get_type() const noexcept override;
+
+private:
+	bool match(const swap_view&, const board_index&, const figure::color&, match_data&) const;
+
+};
+
+
+//// @class vertical_pattern
+//// @note Creates horizontal booster for more than 3 figures
+class vertical_pattern : public pattern
+{
+public:
+	//// @brief Vertical combination of same color figures.
+	//// @return true if found vertical combination
+    bool match(const swap_view&, const board_index&, match_data&) const override;
+
+	//// @brief Gets the reach of runs of 3 - 2
+	size_t get_reach() const noexcept override;
+
+	//// @brief Gets the runs of 3 with the cell
+	bool get_placements(std::vector<uint32_t>&) const override;
+
+	//// @brief Collects the whole run of the cell
+	void set_match(const swap_view&, const board_index&, size_t, match_data&) const override;
+
+	//// @brief Finds the vertical runs of the board column by column (see board::get_runs())
+	void scan(const board&, bitboard&, matches&) const override;
+
+	//// @brief Gets the pattern type
+    pattern::type get_type() const noexcept override;
+
+private:
+	bool match(const swap_view&, const board_index&, const figure::color&, match_data&) const;
+
+};
+
+
+//// @class shape_pattern
+//// @brief Pattern of fixed shape which is described by a small grid of cells
+//// The description is a list of rows with the same length, where
+////	* 'o' - a cell of the shape
+////	* 'x' - a cell of the shape where the booster is created (the first cell by default)
+////	* '.' or ' ' - not a cell of the shape
+//// E.g. { "o..", "xoo", "o.." } is T shape with booster on the junction.
+//// Rotations and mirrors of the shape are generated, then every rotation is compiled into
+//// offset tables (a table per shape cell, offsets are relative to that cell).
+//// So matching is one loop over the tables for any shape.
+class shape_pattern : public pattern
+{
+public:
+	//// The rows of the shape description
+	using description = std::vector<std::string>;
+
+	//// @brief The maximum rows or columns count of the shape - 5
+	static constexpr size_t max_size = 5;
+
+	//// @brief The minimum cells count of the shape - 3
+	static constexpr size_t min_cells_count = 3;
+
+public:
+	//// @brief Constructor
+	//// @param[in] d The shape description
+	//// @param[in] t The pattern type
+	//// @note The shape has no booster
+	//// @throw pattern_error if description is invalid
+	shape_pattern(const description& d, const type& t = type::custom);
+
+	//// @brief Constructor
+	//// @param[in] d The shape description
+	//// @param[in] b The booster type which is created for the match
+	//// @param[in] t The pattern type
+	//// @throw pattern_error if description is invalid
+	shape_pattern(const description& d, const booster::type& b, const type& t = type::custom);
+
+	//// @brief Constructor
+	//// @note Used for built-in shapes (see shapes namespace)
+	template <size_t N>
+	shape_pattern(const char* const (&d)[N], const booster::type& b, const type& t)
+		: shape_pattern(description(d, d + N), b, t)
+	{
+	}
+
+public:
+	//// @brief Validates the shape description
+	//// @throw pattern_error if description is invalid
+	static void validate(const description&);
+
+public:
+	//// @brief Matches the shape (any of rotations) which has figure of given index
+	//// @return true if found the shape
+    bool match(const swap_view&, const board_index&, match_data&) const override;
+
+	//// @brief Finds the shapes in row-major order of their booster cells
+	//// @note The shapes are found on color planes at once, without matching every cell
+	void scan(const board&, bitboard&, matches&) const override;
+
+	//// @brief Gets the pattern type
+    pattern::type get_type() const noexcept override;
+
+	//// @brief Checks if the shape has a run of 3 or a 2x2 square
+	bool is_line_based() const noexcept override;
+
+	//// @brief Gets the maximum offset of the tables
+	size_t get_reach() const noexcept override;
+
+	//// @brief Gets the offset tables as placements
+	bool get_placements(std::vector<uint32_t>&) const override;
+
+	//// @brief Collects the cells of given offset table
+	void set_match(const swap_view&, const board_index&, size_t, match_data&) const override;
+
+	//// @brief Gets the count of shape cells
+	size_t get_cells_count() const noexcept;
+
+	//// @brief Gets the count of different rotations and mirrors of the shape
+	size_t get_variants_count() const noexcept;
+
+private:
+	struct offset
+	{
+		int8_t row;
+		int8_t column;
+	};
+
+	void compile(const description&);
+	//// gets the booster cells of the shapes in a color plane, a mask per rotation or mirror:
+	//// the plane is shifted by every offset of the shape and shifted planes are intersected
+	void find_anchors(const bitboard&, std::vector<bitboard>&) const;
+	bool fits(const swap_view&, const board_index&, const offset*, const figure::color&) const;
+	void collect(const board_index&, const offset*, match_data&) const;
+
+private:
+	//// get_cells_count() offsets per table
+	std::vector<offset> m_tables;
+	//// the tables which are relative to the booster cell, one per variant
+	std::vector<size_t> m_origins;
+	size_t m_cells_count = 0;
+	type m_type;
+	bool m_has_booster = false;
+	booster::type m_booster_type = booster::type::radial;
+	bool m_line_based = false;
+
+};
+
+
+//// Built-in shapes
+namespace shapes {
+
+//// T shape: run of 3 with a perpendicular base of two cells from its middle
+constexpr const char* t_shape[] = {
+	"o..",
+	"xoo",
+	"o.."
+};
+
+//// 2x2 square
+constexpr const char* square[] = {
+	"xo",
+	"oo"
+};
+
+}
+
+#endif // PATTERNS_HPP
@@ -0,0 +1,91 @@
+
+#include "rng.hpp"
+#include "splitmix.hpp"
+
+#include <cassert>
+#include <chrono>
+#include <random>
+
+
+namespace {
+
+uint64_t rotl(uint64_t x, int k) noexcept
+{
+	return (x << k) | (x >> (64 - k));
+}
+
+}
+
+uint64_t rng::make_seed()
+{
+	std::random_device rd;
+	const uint64_t r = (static_cast<uint64_t>(rd()) << 32) ^ rd();
+	const uint64_t t = static_cast<uint64_t>(std::chrono::high_resolution_clock::now().time_since_epoch().count());
+	return r ^ t;
+}
+
+rng::rng(uint64_t seed) noexcept
+{
+	for (auto& it : m_state) {
+		it = splitmix::next(seed);
+	}
+}
+
+rng::result_type rng::operator()() noexcept
+{
+	const uint64_t result = rotl(m_state[1] * 5, 7) * 9;
+	const uint64_t t = m_state[1] << 17;
+	m_state[2] ^= m_state[0];
+	m_state[3] ^= m_state[1];
+	m_state[1] ^= m_state[2];
+	m_state[0] ^= m_state[3];
+	m_state[2] ^= t;
+	m_state[3] = rotl(m_state[3], 45);
+	return result;
+}
+
+uint32_t rng::next_below(uint32_t n) noexcept
+{
+	assert(n > 0);
+	//// the high 32 bits are scaled to the range with multiplication instead of modulo
+	return static_cast<uint32_t>(((operator()() >> 32) * n) >> 32);
+}
+
+void rng::jump() noexcept
+{
+	static const uint64_t s_jump[] = { 0x180ec6d33cfd0abaULL, 0xd5a61266f0c9392cULL, 0xa9582618e03fc9aaULL, 0x39abdc4529b1661cULL };
+	std::array<uint64_t, 4> s = { 0, 0, 0, 0 };
+	for (auto j : s_jump) {
+		for (int b = 0; b < 64; ++b) {
+			if (j & (uint64_t(1) << b)) {
+				for (size_t i = 0; i < s.size(); ++i) {
+					s[i] ^= m_state[i];
+				}
+			}
+			operator()();
+		}
+	}
+	m_state = s;
+}
+
+game_rng::game_rng(uint64_t seed) noexcept
+	: m_seed(seed)
+{
+	//// every stream is the next non-overlapping part of the same sequence
+	rng r(seed);
+	for (auto& it : m_streams) {
+		it = r;
+		r.jump();
+	}
+}
+
+uint64_t game_rng::get_seed() const noexcept
+{
+	return m_seed;
+}
+
+rng& game_rng::get(const stream& s) noexcept
+{
+	assert(static_cast<size_t>(s) < streams_count);
+	return m_streams[static_cast<size_t>(s)];
+}
@@ -0,0 +1,95 @@
+#ifndef CORE_RNG_HPP
+#define CORE_RNG_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+
+//// @class rng
+//// @brief Fast pseudo random generator (xoshiro256**)
+//// The generator has no global state, so every game (or simulation thread) can have its own one.
+//// Same seed gives same sequence on every platform and compiler.
+//// @note It can be used as UniformRandomBitGenerator of the standard library
+class rng
+{
+public:
+	using result_type = uint64_t;
+
+public:
+	//// @brief Gets a seed which differs from run to run
+	static uint64_t make_seed();
+
+	static constexpr result_type min() noexcept
+	{
+		return 0;
+	}
+
+	static constexpr result_type max() noexcept
+	{
+		return ~result_type(0);
+	}
+
+public:
+	//// @brief Constructor
+	//// @param[in] seed Any value, the state is expanded from it with splitmix64
+	explicit rng(uint64_t seed = 0) noexcept;
+
+public:
+	//// @brief Gets the next value
+	result_type operator()() noexcept;
+
+	//// @brief Gets the next value in range [0, n)
+	//// @note n should be positive
+	uint32_t next_below(uint32_t n) noexcept;
+
+	//// @brief Moves the generator 2^128 values forward
+	//// Used to get non-overlapping streams from the same seed
+	void jump() noexcept;
+
+private:
+	std::array<uint64_t, 4> m_state;
+
+};
+
+
+//// @class game_rng
+//// @brief The random streams of one game
+//// Every kind of randomness has its own stream, so e.g. shuffling doesn't change the items which are
+//// dropped later. Same seed and same moves always reproduce the same game.
+class game_rng
+{
+public:
+	using ptr = std::unique_ptr<game_rng>;
+
+	//// @enum stream
+	//// @brief The random streams
+	enum class stream
+	{
+		generation = 0, //// filling the board at start
+		refill, //// new items after cascade steps
+		shuffle //// shuffling board when there are no moves
+	};
+
+	//// @brief The count of streams
+	static constexpr size_t streams_count = 3;
+
+public:
+	//// @brief Constructor
+	explicit game_rng(uint64_t seed) noexcept;
+
+public:
+	//// @brief Gets the seed of the game
+	uint64_t get_seed() const noexcept;
+
+	//// @brief Gets the generator of given stream
+	rng& get(const stream&) noexcept;
+
+private:
+	uint64_t m_seed;
+	std::array<rng, streams_count> m_streams;
+
+};
+
+#endif // CORE_RNG_HPP
@@ -0,0 +1,83 @@
+#ifndef CORE_SPAN_HPP
+#define CORE_SPAN_HPP
+
+#include <cassert>
+#include <cstddef>
+
+
+//// @class span
+//// @brief Non-owning view of contiguous items
+//// It is used to pass items (e.g. matched indexes) without copying them into containers.
+//// @note The viewed items should outlive the span
+template <typename T>
+class span
+{
+public:
+	//// @brief Constructor
+	//// @note Creates an empty span
+	constexpr span() noexcept
+		: m_data(nullptr)
+		, m_size(0)
+	{
+	}
+
+	//// @brief Constructor
+	//// @param[in] d The first item
+	//// @param[in] s The items count
+	constexpr span(T* d, size_t s) noexcept
+		: m_data(d)
+		, m_size(s)
+	{
+	}
+
+	//// @brief Constructor
+	//// @note Views the items of contiguous container (e.g. std::vector)
+	template <typename C>
+	span(C& c) noexcept
+		: m_data(c.data())
+		, m_size(c.size())
+	{
+	}
+
+public:
+	//// @brief Gets the items count
+	constexpr size_t size() const noexcept
+	{
+		return m_size;
+	}
+
+	//// @brief Checks if there are no items
+	constexpr bool empty() const noexcept
+	{
+		return m_size == 0;
+	}
+
+	//// @brief Gets the first item
+	constexpr T* data() const noexcept
+	{
+		return m_data;
+	}
+
+	T* begin() const noexcept
+	{
+		return m_data;
+	}
+
+	T* end() const noexcept
+	{
+		return m_data + m_size;
+	}
+
+	T& operator[] (size_t i) const noexcept
+	{
+		assert(i < m_size);
+		return m_data[i];
+	}
+
+private:
+	T* m_data;
+	size_t m_size;
+
+};
+
+#endif // CORE_SPAN_HPP
@@ -0,0 +1,22 @@
+#ifndef CORE_SPLITMIX_HPP
+#define CORE_SPLITMIX_HPP
+
+#include <cstdint>
+
+
+//// splitmix64 generator, it is used where 64 bit values should be well mixed without a table
+//// (seeding of rng, hash keys of board cells)
+namespace splitmix {
+
+//// @brief Advances given state and gets the next value
+inline uint64_t next(uint64_t& state) noexcept
+{
+	uint64_t z = (state += 0x9e3779b97f4a7c15ULL);
+	z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+	z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+	return z ^ (z >> 31);
+}
+
+}
+
+#endif // CORE_SPLITMIX_HPP
@@ -0,0 +1,92 @@
+#ifndef CORE_SWAP_VIEW_HPP
+#define CORE_SWAP_VIEW_HPP
+
+#include "board.hpp"
+#include "board_index.hpp"
+#include "cell.hpp"
+#include "figure.hpp"
+
+
+//// @class swap_view
+//// @brief Read-only view of board with two swapped cells
+//// View answers cells as if given two indexes were swapped, but the board itself is not changed.
+//// It is used to check hypothetical swaps (e.g. available moves) without touching the board,
+//// so several views can be used at the same time (e.g. from different threads) over one board.
+//// @note The board should outlive the view
+class swap_view
+{
+public:
+	//// @brief Constructor
+	//// @note Creates a view without swapped cells, it shows the board as is
+	explicit swap_view(const board& b) noexcept
+		: m_board(b)
+		, m_first(invalid_index)
+		, m_second(invalid_index)
+	{
+	}
+
+	//// @brief Constructor
+	//// @param[in] b The board
+	//// @param[in] i1 The first swapped index
+	//// @param[in] i2 The second swapped index
+	swap_view(const board& b, const board_index& i1, const board_index& i2) noexcept
+		: m_board(b)
+		, m_first(i1)
+		, m_second(i2)
+	{
+	}
+
+public:
+	//// @brief Gets the board
+	const board& get_board() const noexcept
+	{
+		return m_board;
+	}
+
+	//// @brief Gets the first swapped index
+	//// @return invalid_index if the view has no swapped cells
+	const board_index& get_first() const noexcept
+	{
+		return m_first;
+	}
+
+	//// @brief Gets the second swapped index
+	//// @return invalid_index if the view has no swapped cells
+	const board_index& get_second() const noexcept
+	{
+		return m_second;
+	}
+
+	//// @brief Checks if given index is inside of the board
+	bool contains(const board_index& i) const noexcept
+	{
+		return m_board.contains(i);
+	}
+
+	//// @brief Gets the cell with specified index after swap
+	//// @return the cell if index is valid or an empty cell
+	cell get_cell(const board_index& i) const noexcept
+	{
+		if (i == m_first) {
+			return m_board.get_cell(m_second);
+		} else if (i == m_second) {
+			return m_board.get_cell(m_first);
+		}
+		return m_board.get_cell(i);
+	}
+
+	//// @brief Gets the figure's color with specified index after swap
+	//// @return figure::color::UNDEFINED if the cell doesn't keep a figure
+	figure::color get_color(const board_index& i) const noexcept
+	{
+		return get_cell(i).get_color();
+	}
+
+private:
+	const board& m_board;
+	board_index m_first;
+	board_index m_second;
+
+};
+
+#endif // CORE_SWAP_VIEW_HPP
@@ -0,0 +1,83 @@
+
+#include "thread_pool.hpp"
+
+#include <algorithm>
+#include <cassert>
+
+
+thread_pool::thread_pool(size_t threads)
+	: m_next(0)
+{
+	if (threads == 0) {
+		threads = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+	}
+	//// the calling thread is one of the threads
+	for (size_t i = 1; i < threads; ++i) {
+		m_threads.push_back(std::thread(&thread_pool::work, this));
+	}
+}
+
+thread_pool::~thread_pool()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_stop = true;
+	}
+	m_wake.notify_all();
+	for (auto& it : m_threads) {
+		it.join();
+	}
+}
+
+size_t thread_pool::size() const noexcept
+{
+	return m_threads.size() + 1;
+}
+
+void thread_pool::run(size_t count, const task& t)
+{
+	if (count == 0) {
+		return;
+	}
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		assert(m_active == 0);
+		m_task = &t;
+		m_count = count;
+		m_next = 0;
+		m_active = m_threads.size();
+		++m_generation;
+	}
+	m_wake.notify_all();
+	execute();
+	std::unique_lock<std::mutex> lock(m_mutex);
+	m_done.wait(lock, [this] { return m_active == 0; });
+	m_task = nullptr;
+}
+
+void thread_pool::work()
+{
+	size_t generation = 0;
+	while (true) {
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_wake.wait(lock, [this, generation] { return m_stop || m_generation != generation; });
+			if (m_stop) {
+				return;
+			}
+			generation = m_generation;
+		}
+		execute();
+		std::lock_guard<std::mutex> lock(m_mutex);
+		if (--m_active == 0) {
+			m_done.notify_one();
+		}
+	}
+}
+
+void thread_pool::execute()
+{
+	for (size_t i = m_next++; i < m_count; i = m_next++) {
+		(*m_task)(i);
+	}
+}
@@ -0,0 +1,69 @@
+#ifndef CORE_THREAD_POOL_HPP
+#define CORE_THREAD_POOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+//// @class thread_pool
+//// @brief Fixed set of worker threads which run parallel loops
+//// The threads are created once and wait for work, so a loop costs only waking them up.
+//// The calling thread takes part in the loop too.
+//// @note run() shouldn't be called from several threads at the same time
+class thread_pool
+{
+public:
+    using ptr = std::unique_ptr<thread_pool>;
+
+	//// The loop body, it is called with the item number
+	using task = std::function<void(size_t)>;
+
+public:
+	//// @brief Constructor
+	//// @param[in] threads The count of threads which run the loop (including the calling thread)
+	//// @note All hardware threads are used if threads count is 0
+	explicit thread_pool(size_t threads = 0);
+
+	//// @brief Destructor
+	//// @note Waits for worker threads
+	~thread_pool();
+
+	//// @brief Deleted Copy Constructor
+	thread_pool(const thread_pool&) = delete;
+
+	//// @brief Deleted Copy Assignment
+	thread_pool& operator= (const thread_pool&) = delete;
+
+public:
+	//// @brief Gets the count of threads which run the loop (including the calling thread)
+	size_t size() const noexcept;
+
+	//// @brief Calls given task for every item from 0 to count - 1 and waits for all of them
+	//// @note Items are taken by threads one by one, so the order of calls isn't defined
+	void run(size_t count, const task&);
+
+private:
+	void work();
+	void execute();
+
+private:
+	std::vector<std::thread> m_threads;
+	std::mutex m_mutex;
+	std::condition_variable m_wake;
+	std::condition_variable m_done;
+	const task* m_task = nullptr;
+	size_t m_count = 0;
+	std::atomic<size_t> m_next;
+	size_t m_active = 0;
+	size_t m_generation = 0;
+	bool m_stop = false;
+
+};
+
+#endif // CORE_THREAD_POOL_HPP
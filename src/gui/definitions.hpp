@@ -1,27 +1,35 @@
-
-#ifndef GUI_DEFINITIONS_HPP
-#define GUI_DEFINITIONS_HPP
-
-//// Defines item's width and height
-constexpr int ITEM_SIZE = 80;
-
-//// Frames Per Second
-constexpr int FPS = 12;
-
-//// Frame delay (depends from FPS)
-constexpr float DELAY = (float)1 / FPS;
-
-//// Dropping steps count is 4. E.g dropping items down
-constexpr int STEPS_COUNT = 4;
-
-//// The default time when item will be go down by one row
-constexpr float ROW_DURATION = STEPS_COUNT * DELAY;
-
-//// The board offset
-//// The board Y position is 180
-//// For newly created items the vertical position will be BOARD_OFFSET
-//// The created items should go down from initial position
-constexpr int BOARD_OFFSET = 100;
-
-
-#endif //// GUI_DEFINITIONS_HPP
+
+#ifndef GUI_DEFINITIONS_HPP
+#define GUI_DEFINITIONS_HPP
+
+#include <cstddef>
+
+
+//// The board row/column size limits of GUI
+//// Core allows bigger boards (see board::max_size()), but they don't fit into the window
+constexpr size_t MIN_BOARD_SIZE = 7;
+constexpr size_t MAX_BOARD_SIZE = 10;
+
+//// Defines item's width and height
+constexpr int ITEM_SIZE = 80;
+
+//// Frames Per Second
+constexpr int FPS = 12;
+
+//// Frame delay (depends from FPS)
+constexpr float DELAY = (float)1 / FPS;
+
+//// Dropping steps count is 4. E.g dropping items down
+constexpr int STEPS_COUNT = 4;
+
+//// The default time when item will be go down by one row
+constexpr float ROW_DURATION = STEPS_COUNT * DELAY;
+
+//// The board offset
+//// The board Y position is 180
+//// For newly created items the vertical position will be BOARD_OFFSET
+//// The created items should go down from initial position
+constexpr int BOARD_OFFSET = 100;
+
+
+#endif //// GUI_DEFINITIONS_HPP
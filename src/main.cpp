@@ -1,33 +1,38 @@
-
-#include "core/board.hpp"
-#include "core/exceptions.hpp"
-#include "core/config.hpp"
-#include "core/game_controller.hpp"
-
-#include "gui/main_window.hpp"
-
-#include <boost/property_tree/json_parser.hpp>
-#include <boost/property_tree/ptree.hpp>
-
-#include <cassert>
-#include <iostream>
-
-
-
-int main(int, char*[])
-{
-
-    try {
-     
-		gui::main_window mw;
-		return mw.exec_event_loop();
-
-    } catch(const base_exception& e) {
-        std::cout << "Couldn't launch game ..." << std::endl;
-        std::cout << e.what() << std::endl;
-    } catch (...) {
-        std::cout << "Couldn't launch game ..." << std::endl;
-    }
-
-    return 0;
-}
+
+#include "core/board.hpp"
+#include "core/exceptions.hpp"
+#include "core/config.hpp"
+#include "core/game_controller.hpp"
+
+#include "gui/main_window.hpp"
+
+#include <boost/property_tree/json_parser.hpp>
+#include <boost/property_tree/ptree.hpp>
+
+#include <cassert>
+#include <iostream>
+#include <string>
+
+
+
+int main(int argc, char* argv[])
+{
+
+    try {
+		//// the game can be reproduced with the seed: --seed <INTEGER>
+		if (argc == 3 && std::string(argv[1]) == "--seed") {
+			gui::main_window mw(std::stoull(argv[2]));
+			return mw.exec_event_loop();
+		}
+		gui::main_window mw;
+		return mw.exec_event_loop();
+
+    } catch(const base_exception& e) {
+        std::cout << "Couldn't launch game ..." << std::endl;
+        std::cout << e.what() << std::endl;
+    } catch (...) {
+        std::cout << "Couldn't launch game ..." << std::endl;
+    }
+
+    return 0;
+}
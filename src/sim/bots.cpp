@@ -0,0 +1,107 @@
+
+#include "bots.hpp"
+
+#include "../core/board.hpp"
+#include "../core/board_item.hpp"
+#include "../core/game_controller.hpp"
+#include "../core/move_evaluator.hpp"
+#include "../core/objective.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <vector>
+
+
+namespace sim {
+
+bot::ptr bot::create(const std::string& name, uint64_t seed)
+{
+	if (name == "random") {
+		return ptr(new random_bot(seed));
+	}
+	if (name == "greedy") {
+		return ptr(new greedy_bot);
+	}
+	return nullptr;
+}
+
+void bot::start(uint64_t)
+{
+}
+
+bool bot::find_booster(const game_controller& gc, board_index& i)
+{
+	for (size_t r = 0; r < gc.get_rows(); ++r) {
+		for (size_t c = 0; c < gc.get_cols(); ++c) {
+			const board_item* item = gc.get_board_item(board_index(r, c));
+			if (item != nullptr && item->is_booster()) {
+				i = board_index(r, c);
+				return true;
+			}
+		}
+	}
+	return false;
+}
+
+random_bot::random_bot(uint64_t seed) noexcept
+	: m_rng(seed)
+{
+}
+
+void random_bot::start(uint64_t seed)
+{
+	m_rng = rng(seed);
+}
+
+bool random_bot::choose(game_controller& gc, board_index& i1, board_index& i2)
+{
+	board::moves moves;
+	gc.get_available_moves(moves);
+	if (moves.empty()) {
+		const bool found = find_booster(gc, i1);
+		i2 = i1;
+		return found;
+	}
+	const auto& m = moves[m_rng.next_below(static_cast<uint32_t>(moves.size()))];
+	i1 = m.first;
+	i2 = m.second;
+	return true;
+}
+
+bool greedy_bot::choose(game_controller& gc, board_index& i1, board_index& i2)
+{
+	move_evaluator::results results;
+	gc.evaluate_moves(results);
+	if (results.empty()) {
+		const bool found = find_booster(gc, i1);
+		i2 = i1;
+		return found;
+	}
+	std::vector<objective*> objectives;
+	gc.get_objectives(objectives);
+	size_t best_score = 0;
+	const swap_result* best = nullptr;
+	for (const auto& it : results) {
+		if (!it.valid) {
+			continue;
+		}
+		size_t progress = 0;
+		for (const auto o : objectives) {
+			assert(o != nullptr);
+			progress += std::min(it.destroyed_figures[static_cast<size_t>(o->get_color())], o->get_count());
+		}
+		const size_t score = progress * 1000 + it.boosters_created * 100 + it.destroyed_count;
+		if (best == nullptr || score > best_score) {
+			best = &it;
+			best_score = score;
+		}
+	}
+	if (best == nullptr) {
+		return false;
+	}
+	i1 = best->first;
+	i2 = best->second;
+	return true;
+}
+
+}
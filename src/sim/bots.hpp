@@ -0,0 +1,82 @@
+#ifndef SIM_BOTS_HPP
+#define SIM_BOTS_HPP
+
+#include "../core/board_index.hpp"
+#include "../core/rng.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+
+class game_controller;
+
+namespace sim {
+
+//// @class bot
+//// @brief Interface of bot policies which play the game without GUI
+//// Bot chooses a move, the move is played with game_controller::process_selection() as GUI does.
+class bot
+{
+public:
+	using ptr = std::unique_ptr<bot>;
+
+public:
+	//// @brief Creates the bot with given policy name: random or greedy
+	//// @param[in] seed The seed of bot's own random generator
+	//// @return nullptr if the policy is unknown
+	static ptr create(const std::string& name, uint64_t seed);
+
+public:
+	//// @brief Destructor
+	virtual ~bot() = default;
+
+public:
+	//// @brief Prepares the bot for a new game
+	//// @param[in] seed The seed of game, bots with own random generator reseed it
+	virtual void start(uint64_t seed);
+
+	//// @brief Chooses the move
+	//// @param[out] i1 The first selected index
+	//// @param[out] i2 The second selected index, it is same as the first one to activate a booster
+	//// @return false if there is no move
+	virtual bool choose(game_controller&, board_index& i1, board_index& i2) = 0;
+
+protected:
+	//// @brief Finds a booster which can be activated by selecting it twice
+	static bool find_booster(const game_controller&, board_index&);
+
+};
+
+
+//// @class random_bot
+//// @brief Plays a random valid swap
+class random_bot : public bot
+{
+public:
+	//// @brief Constructor
+	explicit random_bot(uint64_t seed) noexcept;
+
+public:
+	void start(uint64_t seed) override;
+	bool choose(game_controller&, board_index& i1, board_index& i2) override;
+
+private:
+	rng m_rng;
+
+};
+
+
+//// @class greedy_bot
+//// @brief Plays the swap with the best immediate outcome (see move_evaluator)
+//// Progress of objectives is preferred, then created boosters and destroyed items.
+class greedy_bot : public bot
+{
+public:
+	bool choose(game_controller&, board_index& i1, board_index& i2) override;
+
+};
+
+}
+
+#endif // SIM_BOTS_HPP
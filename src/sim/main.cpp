@@ -0,0 +1,174 @@
+
+#include "bots.hpp"
+
+#include "../core/exceptions.hpp"
+#include "../core/game_controller.hpp"
+#include "../core/move_evaluator.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <string>
+
+
+namespace {
+
+//// The command line options
+struct options
+{
+	std::string config;
+	size_t games = 100;
+	std::string bot = "random";
+	uint64_t seed = 1;
+	bool help = false;
+};
+
+void print_usage()
+{
+	std::cout << "Usage: m3sim <CONFIG.JSON> [--games <N>] [--bot random|greedy] [--seed <FIRST SEED>]" << std::endl;
+	std::cout << "       m3sim -h|--help" << std::endl;
+	std::cout << "Plays N games with seeds FIRST SEED ... FIRST SEED + N - 1 without GUI" << std::endl;
+}
+
+//// @return false if the options are invalid, e.g. an option has no value
+bool parse_options(int argc, char* argv[], options& o)
+{
+	for (int i = 1; i < argc; ++i) {
+		const std::string name = argv[i];
+		if (name == "-h" || name == "--help") {
+			o.help = true;
+			return true;
+		}
+		if (name.compare(0, 1, "-") != 0) {
+			if (!o.config.empty()) {
+				return false;
+			}
+			o.config = name;
+			continue;
+		}
+		if (i + 1 >= argc) {
+			return false;
+		}
+		const std::string value = argv[++i];
+		if (name == "--games") {
+			o.games = std::stoul(value);
+		} else if (name == "--bot") {
+			o.bot = value;
+		} else if (name == "--seed") {
+			o.seed = std::stoull(value);
+		} else {
+			return false;
+		}
+	}
+	return !o.config.empty() && o.games > 0;
+}
+
+//// The statistics of played games
+struct statistics
+{
+	size_t passed = 0;
+	size_t failed = 0;
+	size_t stuck = 0;
+	size_t moves = 0;
+	size_t moves_left = 0;
+};
+
+//// Plays one game, the game_controller should be created
+void play(sim::bot& b, uint64_t seed, statistics& s)
+{
+	game_controller* gc = game_controller::get();
+	b.start(seed);
+	gc->start_game(seed);
+	while (gc->get_game_status() == game_controller::game_status::in_progress) {
+		board_index i1 = invalid_index;
+		board_index i2 = invalid_index;
+		const size_t moves_count = gc->get_moves_count();
+		if (!b.choose(*gc, i1, i2)) {
+			break;
+		}
+		gc->process_selection(i1);
+		gc->process_selection(i2);
+		//// the chosen moves are valid, so every turn should take a move
+		if (gc->get_moves_count() == moves_count && gc->get_game_status() == game_controller::game_status::in_progress) {
+			break;
+		}
+		++s.moves;
+	}
+	switch (gc->get_game_status()) {
+		case game_controller::game_status::passed:
+			++s.passed;
+			s.moves_left += gc->get_moves_count();
+			break;
+		case game_controller::game_status::failed:
+			++s.failed;
+			break;
+		default:
+			++s.stuck;
+	}
+}
+
+}
+
+int main(int argc, char* argv[])
+{
+	options o;
+	try {
+		if (!parse_options(argc, argv, o)) {
+			print_usage();
+			return 1;
+		}
+		if (o.help) {
+			print_usage();
+			return 0;
+		}
+	} catch (const std::exception&) {
+		print_usage();
+		return 1;
+	}
+	sim::bot::ptr b = sim::bot::create(o.bot, o.seed);
+	if (!b) {
+		print_usage();
+		return 1;
+	}
+	try {
+		//// the config is loaded and the patterns are built once, the games only reset the board (see start_game())
+		game_controller::create(o.config);
+		const game_controller* gc = game_controller::get();
+		if (o.bot == "greedy" && (gc->get_rows() > move_evaluator::max_size() || gc->get_cols() > move_evaluator::max_size())) {
+			std::cout << "Greedy bot supports boards up to " << move_evaluator::max_size() << "x" << move_evaluator::max_size() << std::endl;
+			game_controller::destroy();
+			return 1;
+		}
+		statistics s;
+		const auto start = std::chrono::steady_clock::now();
+		for (size_t g = 0; g < o.games; ++g) {
+			play(*b, o.seed + g, s);
+		}
+		const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+		std::cout << "games: " << o.games << " (seeds " << o.seed << " - " << o.seed + o.games - 1 << ", bot " << o.bot << ")" << std::endl;
+		const double games = static_cast<double>(o.games);
+		std::cout << "passed: " << s.passed << " (" << 100.0 * static_cast<double>(s.passed) / games << "%)" << std::endl;
+		std::cout << "failed: " << s.failed << std::endl;
+		if (s.stuck != 0) {
+			std::cout << "stuck: " << s.stuck << std::endl;
+		}
+		std::cout << "moves: " << s.moves << " (" << static_cast<double>(s.moves) / games << " per game)" << std::endl;
+		if (s.passed != 0) {
+			std::cout << "moves left on pass: " << static_cast<double>(s.moves_left) / static_cast<double>(s.passed) << std::endl;
+		}
+		std::cout << "time: " << seconds << " s" << std::endl;
+		if (seconds > 0) {
+			std::cout << "games/s: " << games / seconds << std::endl;
+			std::cout << "moves/s: " << static_cast<double>(s.moves) / seconds << std::endl;
+		}
+		game_controller::destroy();
+	} catch (const base_exception& e) {
+		std::cout << "Couldn't run simulation ..." << std::endl;
+		std::cout << e.what() << std::endl;
+		return 1;
+	} catch (...) {
+		std::cout << "Couldn't run simulation ..." << std::endl;
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,96 @@
+
+#include "../core/board.hpp"
+#include "../core/boosters.hpp"
+#include "../core/cell.hpp"
+#include "../core/figure.hpp"
+#include "../core/matcher.hpp"
+#include "../core/move_evaluator.hpp"
+#include "../core/patterns.hpp"
+
+#include <cstddef>
+#include <iostream>
+
+
+namespace {
+
+size_t failures = 0;
+
+void check(bool condition, const char* what)
+{
+	if (!condition) {
+		std::cout << "FAILED: " << what << std::endl;
+		++failures;
+	}
+}
+
+//// The patterns of game_controller
+matcher::ptr create_matcher()
+{
+	matcher::ptr m(new matcher());
+	m->add_pattern(pattern::ptr(new shape_pattern(shapes::t_shape, booster::type::radial, pattern::type::t)));
+	m->add_pattern(pattern::ptr(new shape_pattern(shapes::square, booster::type::radial, pattern::type::radial)));
+	m->add_pattern(pattern::ptr(new horizontal_pattern));
+	m->add_pattern(pattern::ptr(new vertical_pattern));
+	m->set_mode(matcher::mode::lookup);
+	return m;
+}
+
+//// Fills the board so that no neighbours have the same color
+void fill(board& b)
+{
+	for (size_t i = 0; i < b.rows(); ++i) {
+		for (size_t j = 0; j < b.columns(); ++j) {
+			b.add_item(cell::from_color(static_cast<figure::color>((i + 2 * j) % figure::colors_count)), board_index(i, j));
+		}
+	}
+}
+
+//// The horizontal booster clears row 3, then column 5 drops into a run of 3 at rows 3-5.
+//// The run is away from the swapped cells, so it is found only by scanning the whole board.
+void test_booster_blast_match()
+{
+	board b(7, 7);
+	fill(b);
+	b.add_item(cell::from_color(figure::color::orange), board_index(4, 5));
+	b.add_item(cell::from_color(figure::color::orange), board_index(5, 5));
+	b.add_item(cell::from_booster(booster::type::horizontal), board_index(3, 0));
+	matcher::ptr m = create_matcher();
+	move_evaluator e(*m, 1);
+	swap_result r;
+	e.evaluate(b, board_index(3, 0), board_index(3, 1), r);
+	check(r.valid, "booster swap is valid");
+	check(r.boosters_activated == 1, "booster is activated");
+	check(r.matches_count == 1, "blast makes a match away from the swap");
+	check(r.cascade_depth == 1, "the match is a cascade step");
+	check(r.destroyed_count == 10, "the row and the run are destroyed");
+}
+
+//// A plain swap which makes a horizontal run of 3
+void test_swap_match()
+{
+	board b(7, 7);
+	fill(b);
+	b.add_item(cell::from_color(figure::color::blue), board_index(0, 1));
+	matcher::ptr m = create_matcher();
+	move_evaluator e(*m, 1);
+	swap_result r;
+	e.evaluate(b, board_index(0, 2), board_index(1, 2), r);
+	check(r.valid, "swap is valid");
+	check(r.matches_count >= 1, "swap makes a match");
+	check(r.destroyed_figures[static_cast<size_t>(figure::color::blue)] >= 3, "the run is destroyed");
+}
+
+}
+
+
+int main()
+{
+	test_booster_blast_match();
+	test_swap_match();
+	if (failures != 0) {
+		std::cout << failures << " checks failed" << std::endl;
+		return 1;
+	}
+	std::cout << "All checks passed" << std::endl;
+	return 0;
+}